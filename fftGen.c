@@ -51,6 +51,33 @@ fftGen - Generate code to compute an FFT or IFFT
 [\c -o] [\c \--real-out-opt]
 [\c -m] [\c \--symm-in-opt]
 [\c -s] [\c \--symm-out-opt]
+[\c -R \e number] [\c \--radix \e number]
+[\c -S] [\c \--split-radix]
+[\c -d] [\c \--dif]
+[\c -b] [\c \--no-bitrev]
+[\c -k] [\c \--stockham]
+[\c -p] [\c \--out-of-place]
+[\c -I \e stride] [\c \--istride \e stride]
+[\c -O \e stride] [\c \--ostride \e stride]
+[\c -f] [\c \--real-fft]
+[\c -C] [\c \--dct2]
+[\c -D] [\c \--dct3]
+[\c -M] [\c \--mdct]
+[\c -w] [\c \--sine-window]
+[\c -Z] [\c \--bluestein]
+[\c -B \e number] [\c \--bins \e number]
+[\c -F \e number] [\c \--start-bin \e number]
+[\c -W \e number] [\c \--bin-spacing \e number]
+[\c -K \e number] [\c \--block \e number]
+[\c -N \e number] [\c \--batch \e number]
+[\c -e \e name] [\c \--function \e name]
+[\c -t \e type] [\c \--type \e type]
+[\c -A \e number] [\c \--align \e number]
+[\c -T] [\c \--twiddle-table]
+[\c -L \e number] [\c \--codelet \e number]
+[\c -x \e name] [\c \--simd \e name]
+[\c -c \e layout] [\c \--layout \e layout]
+[\c -u \e form] [\c \--cmul \e form]
 [\c -l] [\c \--license]
 [\c -v] [\c \--verbose]
 [\c -V] [\c \--version]
@@ -70,8 +97,11 @@ the generated code is to compute the algorithms in a very fast way.
 The program needs to know the number of data points for the FFT. Either option
 \c -n or \c \-\-points must therefore always be specified when the program is
 called. The value of these options specifies the number of data points. It must
-always be a power of two and it must not be zero. It may be equal one, however,
-value one doesn't make much sense because in that case no code is produced.
+be a product of the prime factors 2, 3, 5, and 7, or a prime \c p with \c p-1
+being such a product, and it must not be zero. It may be equal one, however,
+value one doesn't make much sense because in that case no code is produced. Most
+optimizations require the number of data points to be a power of two, see
+\ref Optimizations.
 
 If the program shall compute an inverse FFT then option \c -i or \c \-\-inverse
 must be given as argument. Note that in this case the result is scaled by
@@ -79,7 +109,9 @@ must be given as argument. Note that in this case the result is scaled by
 inverse FFT the results of the generated code must be divided by \c n.
 
 The transform is conducted \"in place\", that means the resulting output
-sequence overwrites the input sequence.
+sequence overwrites the input sequence. Only the code generated with options
+\c -k and \c -p works \"out of place\", it reads the input sequence from the
+arrays <tt>xr_in[]</tt> and <tt>xi_in[]</tt>, see \ref Optimizations.
 
 
 \subsection Optimizations Optimizations
@@ -190,6 +222,400 @@ standard Cooley-Tukey algorithm:
    for real and imaginary values from the value with index n/2+1 onwards
    (indices starting at 0) because these values are ignored.
 
+10. Using radix-4 butterflies
+
+    By default the transform is computed in log2(n) stages of radix-2
+    butterflies. With option \c -R \c 4 two consecutive stages are combined
+    into one stage of radix-4 butterflies. A radix-4 butterfly requires three
+    complex multiplications by twiddle factors instead of four in the according
+    radix-2 butterflies, and the sequence is passed only half as often. If the
+    number of radix-2 stages is odd then the first stage remains a radix-2 stage.
+
+    All other optimizations are available with radix-4 butterflies as well.
+
+11. Using the split-radix algorithm
+
+    With option \c -S the transform is computed by the split-radix algorithm.
+    It splits a transform of length \c n into one of length n/2 and two of
+    length n/4, which are combined by L-shaped butterflies - radix-2 for the
+    first and radix-4 for the other two parts. Among the algorithms for n being a
+    power of two it requires the lowest number of arithmetic operations. For
+    \c n=1024 the generated code contains about 30% less multiplications than
+    the radix-2 code.
+
+    All other optimizations are available with the split-radix algorithm as
+    well.
+
+12. Using decimation in frequency and omitting the bit reversal
+
+    By default the transform is computed by decimation in time: the sequence is
+    first brought into bit reversed order by the binary inversion algorithm,
+    then the butterfly stages follow. With option \c -d the decimation in
+    frequency variant is generated instead. It starts with the butterfly stages
+    on the sequence in natural order and finishes with the binary inversion
+    algorithm on the result.
+
+    With option \c -b the binary inversion algorithm is omitted. With option
+    \c -d the result is then left in bit reversed order, without it the input
+    sequence is expected in bit reversed order. If the spectrum is e.g. only
+    multiplied elementwise before it is transformed back then the forward
+    transform can be generated with options \c -d \c -b and the inverse
+    transform with option \c -b. The permutation is then saved completely.
+
+    All other optimizations are available with both options as well. Option
+    \c -d is available with radix-2 butterflies only.
+
+13. Using the Stockham autosort algorithm
+
+    With option \c -k the code for the Stockham autosort algorithm is
+    generated. It works out of place: the input sequence is read from the arrays
+    <tt>xr_in[]</tt> and <tt>xi_in[]</tt>, and each stage writes its results
+    to another array than it reads from, alternately to <tt>xr[]</tt>/<tt>xi[]</tt>
+    and <tt>yr[]</tt>/<tt>yi[]</tt>. The stages are arranged such that the
+    result ends up in natural order in <tt>xr[]</tt> and <tt>xi[]</tt>. So
+    neither the binary inversion algorithm nor its moves of the sequence
+    elements are required, and the elements are accessed with unit stride
+    within each stage.
+
+    All other optimizations are available with the Stockham algorithm as well.
+
+14. Computing a real FFT by a complex FFT of half the length
+
+    Optimizations 6. and 7. (options \c -r and \c -s) remove operations from a
+    complex FFT of length \c n. With option \c -f instead, the \c n real input
+    values are stored in one array <tt>x[]</tt>, regarded as n/2 complex values
+    with the real parts at even and the imaginary parts at odd indices, and
+    transformed by a complex FFT of length n/2. A final stage of n/4 butterflies
+    with twiddle factors separates the result into the transforms of the values
+    at even and odd indices and combines them to the transform of the real
+    sequence. This takes about half the operations and half the memory of the
+    complex FFT with options \c -r and \c -s.
+
+    The result is stored in <tt>x[]</tt> in the packed format
+    \code
+      x[0] = Re X[0]
+      x[1] = Re X[n/2]
+      x[2k] = Re X[k],  x[2k+1] = Im X[k]     for k=1...n/2-1
+    \endcode
+    X denoting the transform of the real sequence. X[0] and X[n/2] are real
+    values, the elements from n/2+1 onwards are given by the symmetry
+    relationship of optimization 7.
+
+    Together with option \c -i the inverse transform is generated. It takes
+    X[0]...X[n/2] in the packed format from <tt>x[]</tt>, reverses the final
+    stage described above, computes the inverse complex FFT of length n/2 and
+    so writes the \c n real result values to <tt>x[]</tt>. Like the results of
+    the inverse complex FFT they are scaled by \c n. This takes about half the
+    operations of the inverse complex FFT with options \c -m and \c -o.
+
+    The complex FFT of length n/2 can be generated with options \c -R, \c -S,
+    and \c -d. Options \c -r, \c -s, \c -m, \c -o, \c -b, and \c -k can't
+    be combined with option \c -f.
+
+15. Using mixed-radix butterflies for numbers of points not a power of two
+
+    If the number of data points \c n is a power of 3, 5, or 7, the code for a
+    mixed-radix Cooley-Tukey algorithm is generated. Numbers of points with
+    several prime factors are handled by optimization 18., which uses this
+    algorithm for their prime power factors, e.g. 8 or 9. The sequence
+    elements are first moved by a digit reversal permutation, the
+    generalization of the binary inversion algorithm. Then the factors of \c n
+    are processed, the factors 2 by radix-2 butterflies, the factors 3, 5, and
+    7 by butterflies computing a DFT of that length with hard-coded sine and
+    cosine function values. These butterflies exploit the symmetry of the sine
+    and cosine values, so e.g. a radix-3 butterfly takes 4 real
+    multiplications, a radix-5 butterfly 16, and a radix-7 butterfly 36,
+    omitting the twiddle factors. Optimizations 1. to 5. are applied to them,
+    in particular the twiddle factors equal to one are omitted.
+
+    Optimizations 6. to 13. are available for a power of two only. With option
+    \c -f the number of points must be even, the complex FFT of length n/2 is
+    then generated as a mixed-radix or prime factor transform if n/2 is not a
+    power of two.
+
+16. Using Rader's algorithm for prime numbers of points
+
+    If the number of data points \c p is a prime greater than 7, e.g. 17, 31,
+    61, or 127, Rader's algorithm is applied. It rewrites the DFT of length
+    \c p as a cyclic convolution of length p-1, which is computed by an FFT of
+    length p-1, a multiplication by the transform of the constant convolution
+    kernel, and an inverse FFT of length p-1. So p-1 must be a product of the
+    prime factors 2, 3, 5, and 7. The FFTs of length p-1 are generated as
+    described in optimization 18., or with the split-radix algorithm if p-1 is
+    a power of two. The transform of the convolution kernel and all index
+    permutations are computed at generation time, the constants are inserted
+    into the code like the sine and cosine function values. The permutations
+    required by the algorithm and by the FFTs of length p-1 are merged, and
+    the multiplication by the kernel transform is done while moving the
+    sequence elements. For p=127 this takes 4180 real multiplications compared
+    to 64516 for the DFT.
+
+    With option \c -f the number of points may be twice such a prime.
+
+17. Using the Bluestein algorithm for arbitrary numbers of points and zoom
+    spectra
+
+    With option \c -Z the code for the Bluestein algorithm is generated for any
+    number of points \c n. It computes the chirp z-transform
+    \code
+      X[k] = sum_j(x[j] * exp(-2*pi*i*j*(f0+k*df)/n))     for k=0...m-1
+    \endcode
+    for \c m bins starting at the frequency \c f0 with the spacing \c df, both
+    in units of the bin spacing of the DFT, see options \c -B, \c -F, and
+    \c -W. By default \c f0=0, \c df=1, and \c m=n, i.e. the DFT of length
+    \c n is computed. The sum is rewritten as a convolution of the input values
+    multiplied by a chirp with another chirp. This convolution is computed by
+    FFTs of the smallest length \c L being a power of two with \c L>=n+m-1.
+    All chirp values and the transform of the convolution kernel are computed
+    at generation time and inserted into the code. The forward FFT uses
+    decimation in frequency, which omits all operations on the zero padded
+    elements. The kernel is multiplied in bit reversed order, and the inverse
+    FFT uses the split-radix algorithm starting from bit reversed order, so
+    no permutation is required at all.
+
+    So a narrow band of the spectrum can be analysed at a fine resolution at
+    O(n log n) costs. E.g. 64 bins with spacing 1/8 for \c n=1000 take 67876
+    real multiplications, compared to 112872 for a zero padded split-radix FFT
+    of length 8192.
+
+18. Using the prime factor algorithm for numbers of points with coprime
+    factors
+
+    If the number of data points \c n has several of the prime factors 2, 3, 5,
+    and 7, e.g. 15, 21, 35, 105, or 480, the code for the Good-Thomas prime
+    factor algorithm is generated. \c n is split into coprime factors being
+    powers of a prime, e.g. 480=32*3*5. The index mapping by the Chinese
+    remainder theorem turns the DFT into a multi-dimensional DFT of these
+    lengths without any twiddle factors between the dimensions. The mapping is
+    resolved at generation time, like the bit reversal, and the same mapping
+    is used for the input and the output. So each sequence element keeps its
+    index and no permutation is required at all. The transforms along the
+    dimensions are radix-2 butterflies, rotated radix-3, -5, and -7
+    butterflies only differing in their constants, or mixed-radix transforms
+    for the prime powers, see optimization 15. For \c n=105 this takes 1016
+    real multiplications compared to 1576 for the mixed-radix Cooley-Tukey
+    algorithm, for \c n=480 4216 compared to 7816.
+
+19. Generating a DCT-II or DCT-III without extra passes
+
+    With option \c -C the code for the DCT-II
+    \code
+      X[k] = sum_j(x[j] * cos(pi*(2j+1)*k/(2n)))          for k=0...n-1
+    \endcode
+    of \c n real values is generated, with option \c -D the code for its
+    inverse, the DCT-III
+    \code
+      x[j] = X[0]/2 + sum_k(X[k] * cos(pi*(2j+1)*k/(2n)))  for j=0...n-1
+    \endcode
+    with the sum running over k=1...n-1. So the DCT-III of the DCT-II yields
+    the input scaled by n/2. The DCT is computed by a complex FFT of length n/2
+    like the real FFT of optimization 14., with the sequence reordered to
+    x[0], x[2], ..., x[n-2], x[n-1], x[n-3], ..., x[1] (Makhoul). The
+    reordering is merged with the bit reversal of the FFT to one permutation.
+    The rotation of the spectrum by exp(-i*pi*k/(2n)), which turns the FFT
+    into the DCT, is folded with the factors 1/2 of the real FFT into the
+    literal constants of its post-processing stage. So 4 values of the DCT
+    take 12 real multiplications there. Apart from a final permutation, which
+    only moves the results to their natural order, no extra passes over the
+    data and no intermediate complex arrays are required. The complex FFT can
+    be generated with options \c -R and \c -S, the number of points must be
+    even.
+
+20. Generating an MDCT or IMDCT with the window merged into the constants
+
+    With option \c -M the code for the modified discrete cosine transform
+    \code
+      X[k] = sum_j(w[j]*x[j] * cos(2*pi/n*(j+1/2+n/4)*(k+1/2)))    k=0...n/2-1
+    \endcode
+    of \c n real values is generated, together with option \c -i the code for
+    the inverse transform
+    \code
+      y[j] = w[j] * sum_k(X[k] * cos(2*pi/n*(j+1/2+n/4)*(k+1/2)))  j=0...n-1
+    \endcode
+    as used by overlapped transform codecs. w[j] is the sine window
+    sin(pi*(j+1/2)/n) with option \c -w, otherwise one. Adding the IMDCT
+    results of successive blocks overlapping by n/2 values then yields the
+    input scaled by n/4. The MDCT folds the input to n/2 values and computes
+    their DCT-IV by a complex FFT of length n/4 between two rotations by
+    complex factors. The window, the folding, and the first rotation are
+    merged into the literal constants of one pass, the second rotation writes
+    the result in natural order. The IMDCT takes the reverse way, the window
+    and the unfolding are merged into the second rotation. Besides these two
+    passes only one move only permutation is required, into which the bit
+    reversal of the FFT is merged. With window the code for \c n=1024 takes
+    4892 real multiplications, without window 3868, using the split-radix
+    algorithm. The complex FFT can be generated with options \c -R and
+    \c -S, the number of points must be a multiple of 4.
+
+21. Two-dimensional FFT
+
+    With option \c -n given as \e rows\c x\e cols the program generates
+    code for the two-dimensional FFT of an image stored row by row in
+    <tt>xr[]</tt> and <tt>xi[]</tt>. The transform is computed by the FFTs of
+    all rows followed by the FFTs of all columns, each generated like a
+    one-dimensional FFT working on the elements of the row or column in place,
+    so no transposition is required. In this row-column mode each column is
+    transformed completely before the next one, its elements being \e cols
+    apart. With option \c -K the columns are instead transformed in blocks of
+    adjacent columns: every butterfly and every swap of the bit reversal
+    permutation is generated for all columns of the block one after the other,
+    so consecutive statements access neighboring elements of one row and each
+    cache line fetched is used completely. The number of operations is the
+    same in both modes. Options \c -r, \c -o, \c -R, \c -S, \c -d, and
+    \c -b apply to the transforms of both dimensions, option \c -r is
+    exploited by the row FFTs and option \c -o by the column FFTs.
+
+22. Three-dimensional FFT
+
+    With option \c -n given as \e planes\c x\e rows\c x\e cols the
+    program generates code for the three-dimensional FFT of a volume stored
+    plane by plane, each plane row by row. Like the two-dimensional FFT it is
+    computed by one-dimensional FFTs along each axis working in place, without
+    copies or transpositions. The traversal order keeps the working set small:
+    first the two-dimensional FFT of each plane is completed while the plane
+    stays in the cache, e.g. 16 kB for a 32x32 plane of \c double values, then
+    the FFTs along the planes are computed row by row. With option \c -K the
+    latter are transformed in blocks of adjacent columns as well, so that each
+    access to a plane hits consecutive elements.
+
+23. Batch of interleaved signals
+
+    With option \c -N the code transforms several independent signals of
+    the same length at once. They are stored interleaved, element \c i of
+    signal \c b at index <tt>i*B+b</tt>, \c B being the number of signals.
+    As the unrolled code contains no data dependent control flow, every
+    butterfly, every swap, and every cycle of a permutation is generated
+    \c B times in a row for the adjacent elements of the signals, for any
+    number of points. These groups of identical statements map directly onto
+    SIMD instructions with \c B lanes, so the compiler vectorizes them
+    without any shuffles, e.g. \c B=4 for AVX with \c double values. All
+    options for the FFT of a single signal except \c -k can be applied.
+
+24. Complete functions with restrict qualified arrays
+
+    With option \c -e the code is written as a complete function. Its array
+    parameters are \c restrict qualified, so the compiler doesn't have to
+    assume that <tt>xr[]</tt> and <tt>xi[]</tt> overlap. Only then it is
+    free to reorder the loads and stores of the unrolled code and to merge
+    them into SIMD instructions. With option \c -A the arrays are
+    additionally declared to be aligned, which saves the compiler the
+    handling of unaligned accesses.
+
+25. Table of constants
+
+    With option \c -T the sine and cosine function values are not written
+    as literal constants into the statements but stored once in the
+    <tt>static const</tt> array <tt>tw[]</tt> of the element type given by
+    option \c -t, which the statements reference, e.g. <tt>tw[5]*xr[3]</tt>.
+    Values occurring several times are stored only once. Literal constants
+    are of type \c double, so with \c float arrays every multiplication
+    with a constant converts to \c double and back. The table avoids that
+    and halves the size of the constants. For \c double arrays GCC
+    generates the same machine code for both variants, as it folds the
+    table elements into the instructions. The script \c makebench.sh
+    compares the size and speed of both variants.
+
+26. Unrolled codelets and loops
+
+    The size of the fully unrolled code grows with <tt>n*log2(n)</tt>, see
+    \ref Size, which is impractical beyond some thousand points. With
+    option \c -L \e c only the FFT of \e c points is unrolled. The
+    generated code does the bit reversal permutation by a loop, applies the
+    unrolled codelet in a loop to all blocks of \e c adjacent points, which
+    are the first <tt>log2(c)</tt> stages of the FFT. The remaining stages
+    are done in passes of <tt>log2(c)</tt> stages each, the last one
+    possibly less. A pass multiplies the elements by the twiddle factors,
+    which are computed once for all blocks as products of two values from
+    tables of about <tt>sqrt(n)</tt> cosine and sine values each, and
+    applies the unrolled codelet to elements \e h apart, \e h being the
+    size of the transforms done by the preceding stages. So the code size is
+    bounded by the codelets, one for each pass, and the small tables,
+    while all stages keep the speed of the unrolled code. A codelet of some
+    64 points is a good choice, larger ones access too many elements far
+    apart at once in the outer passes for the level 1 cache. Options
+    \c -R, \c -S, and \c -u apply to the codelets, option \c -u also to
+    the multiplications by the computed twiddle factors.
+
+27. SIMD intrinsics
+
+    Compilers hardly vectorize the unrolled code of a single signal, as its
+    statements don't come in groups of identical operations on adjacent
+    elements like with option \c -N. With option \c -x \e name the
+    radix-2 stages are written with the intrinsics of the SIMD instruction
+    set \e name, \c sse2 with vectors of 16 bytes or \c avx2 with vectors
+    of 32 bytes. In the stage with the distance \c k of the butterflies the
+    butterflies of adjacent twiddle factors access adjacent elements, so as
+    many of them as a vector has lanes, e.g. four with \c avx2 and
+    \c double, are computed by one vector operation, the twiddle factors
+    packed into vectors. The stages with \c k less than the number of lanes
+    are done within the registers: Each vector is loaded once, the operands
+    of the butterflies are distributed to the lanes by shuffles, and the
+    vector is stored after the last of these stages. With \c avx2 the
+    complex multiplications use fused multiply-add instructions. The
+    intrinsics are available with GCC, Clang, and MSVC on x86 processors.
+    With \c vec\e N, e.g. \c vec32, the code uses the vector extensions of
+    GCC and Clang instead, i.e. vectors of \e N bytes defined by
+    <tt>__attribute__ ((vector_size (N)))</tt>, the usual operators, and
+    <tt>__builtin_shufflevector()</tt>. The compiler maps them to the SIMD
+    instructions selected by its option \c -march, e.g. \c vec32 to SSE2
+    or to AVX, and \c vec64 to AVX-512. So one generated source serves all
+    instruction sets, also other processor architectures.
+
+28. Interleaved complex values
+
+    Applications usually store complex values as pairs of real and
+    imaginary part, e.g. as C99 \c complex, C++ \c std::complex, or as a
+    structure of two members. For the arrays <tt>xr[]</tt> and <tt>xi[]</tt>
+    they have to be split before and merged after each FFT, two copy passes
+    over the data. With option \c -c \c interleaved the code works on such
+    an array directly, <tt>x[2k]</tt> and <tt>x[2k+1]</tt> being the real and
+    imaginary part of element \c k. With option \c -c \c c99complex the
+    function generated with option \c -e takes a C99 complex array.
+
+29. Out-of-place transform
+
+    The code works in place and overwrites the input sequence. If the input is
+    still needed, e.g. to apply several analyses to the same frame, the caller
+    has to copy it first. With option \c -p the code reads the input from the
+    arrays <tt>xr_in[]</tt> and <tt>xi_in[]</tt> and writes the result to
+    <tt>xr[]</tt> and <tt>xi[]</tt>. The input arrays are not modified,
+    declared \c const by option \c -e. The binary inversion algorithm then
+    becomes a gather: each element is assigned once from its bit reversed
+    index of the input, without the swaps over the temporaries and without
+    the copy of the caller. With option \c -b the input is just copied.
+
+30. Strided sequences
+
+    A column of a matrix stored row by row or one channel of an interleaved
+    multichannel buffer are sequences of elements a constant distance apart.
+    Gathering such a sequence into contiguous arrays and scattering the
+    result back triples the memory traffic. With options \c -I and \c -O
+    the code accesses the elements in place instead, element \c k at index
+    <tt>k*S</tt>. A number \e S is folded into the indices of the generated
+    code. The name of a variable makes the code work for any stride given at
+    run time, at the cost of the address computations, so a known stride
+    should be given as number.
+
+31. Forms of the complex multiplication
+
+    The multiplication of a complex value by a twiddle factor
+    <tt>wr+i*wi</tt> needs four multiplications and two additions,
+    <tt>tr = wr*xr - wi*xi</tt> and <tt>ti = wr*xi + wi*xr</tt>. As the
+    twiddle factors are constants of the code, other forms come at no cost
+    of precomputations. Option \c -u selects the form: \c fma writes
+    <tt>tr = fma(wr, xr, -wi*xi)</tt>, i.e. two multiplications and two
+    fused multiply-adds, independently of the contraction done by the
+    compiler. \c 3mul computes <tt>tk = wr*(xr + xi)</tt>,
+    <tt>tr = tk - (wr+wi)*xi</tt>, and <tt>ti = tk + (wi-wr)*xr</tt>, three
+    multiplications and three additions. \c ratio writes
+    <tt>tr = wr*(xr - (wi/wr)*xi)</tt> and <tt>ti = wr*(xi + (wi/wr)*xr)</tt>,
+    factored by \c wi instead if it is the greater one, which the compiler
+    contracts to one multiplication and one fused multiply-add each. For the
+    twiddle factors of the angles pi/4 it becomes
+    <tt>tr = wr*(xr + xi)</tt>. Which form is the fastest depends on the
+    processor, its support of FMA instructions enabled e.g. by the compiler
+    option \c -mfma, and the compiler. Without FMA instructions \c fma()
+    is a slow library function.
 
 
 \subsection Combinations Combinations of Optimizations
@@ -232,16 +658,21 @@ m   n       LOC_B   LOC_T   Total
 9   512     1440    13824   15264
 10  1024    2976    30720   33696
 \endcode
-Optimizations 6. to 9. will reduce the number of code lines a bit. For
+Optimizations 6. to 24. will reduce the number of code lines a bit. For
 <tt>m</tt>=5 (i.e. <tt>n</tt>=32) with optimizations 6. and 7. (options \c -r
-and \c -s) the total number of code lines reduces to 365.
+and \c -s) the total number of code lines reduces to 365. Optimization 25.
+(option \c -T) adds the lines of the table. With optimization 26. (option
+\c -L) the number of code lines is the one of the codelet for each pass plus
+some 20 lines of loops for each, and about <tt>sqrt(n)</tt> lines of the
+tables of the cosine and sine values.
 
 
 
 \section Integration INTEGRATION
 
-The program generates the FFT code only, no function header and no function
-ending. The generated code requires some defined variables:
+Unless option \c -e is given the program generates the FFT code only, no
+function header and no function ending. The generated code requires some
+defined variables:
 - Two defined arrays for the complex sequence points, in particular
   - array <tt>xr[]</tt> for the real values and
   - array <tt>xi[]</tt>.
@@ -251,11 +682,92 @@ ending. The generated code requires some defined variables:
 - Two variables to store intermediate values:
   - <tt>tr</tt> and
   - <tt>ti</tt>.
+  .
+  Code generated with options \c -R \c 4 or \c -S requires the four
+  additional variables <tt>ur</tt>, <tt>ui</tt>, <tt>vr</tt>, and <tt>vi</tt>.
+  Code generated with option \c -u \c 3mul requires the additional variable
+  <tt>tk</tt>, code generated with option \c -u \c fma the header
+  <tt>math.h</tt>, which the function of option \c -e includes.
+- Code generated with option \c -k reads the input sequence from the arrays
+  <tt>xr_in[]</tt> and <tt>xi_in[]</tt>, which are not modified. It requires
+  the two additional arrays <tt>yr[]</tt> and <tt>yi[]</tt> as work space.
+  All four arrays must be of size \c n as well.
+- Code generated with option \c -p reads the input sequence from the arrays
+  <tt>xr_in[]</tt> and <tt>xi_in[]</tt> of size \c n, which are not
+  modified, and writes the result to <tt>xr[]</tt> and <tt>xi[]</tt>.
+- Code generated with options \c -I or \c -O accesses the sequence element
+  \c k at index <tt>k*S</tt> of its array for the stride \e S, so the arrays
+  must be of size <tt>(n-1)*S+1</tt>. If the stride is given as the name of a
+  variable, the variable must be defined where the code is included. The
+  function generated with option \c -e takes it as \c int parameter after
+  the arrays.
+- Code generated with option \c -f works on the one array <tt>x[]</tt> of size
+  \c n instead of <tt>xr[]</tt> and <tt>xi[]</tt>. It requires the
+  temporaries <tt>tr</tt>, <tt>ti</tt>, <tt>ur</tt>, <tt>ui</tt>,
+  <tt>vr</tt>, and <tt>vi</tt>.
+- Code generated for a number of points not being a power of two requires the
+  temporaries <tt>tr</tt>, <tt>ti</tt>, <tt>ur</tt>, and <tt>ui</tt>, and if
+  the number of points has a factor 3, 5, or 7 the two additional arrays
+  <tt>br[]</tt> and <tt>bi[]</tt> of size 7. For a prime number of points \c p
+  the same applies to the factors of p-1. If p-1 is a power of two then the
+  temporaries <tt>vr</tt> and <tt>vi</tt> are required instead of the arrays.
+- Code generated with options \c -C and \c -D works on the one array
+  <tt>x[]</tt> of size \c n like with option \c -f and requires the same
+  temporaries.
+- Code generated with option \c -M works on the one array <tt>x[]</tt> of size
+  \c n and requires the same temporaries as with option \c -f. The MDCT
+  stores its n/2 results in the first half of <tt>x[]</tt>. The IMDCT takes
+  its n/2 input values from there and writes its \c n results to
+  <tt>x[]</tt>, which are to be added to the overlapping half of the results
+  of the neighbouring blocks.
+- Code generated with option \c -n \e rows\c x\e cols works on the arrays
+  <tt>xr[]</tt> and <tt>xi[]</tt> of size \e rows*\e cols holding the image
+  row by row, i.e. the point of row \c r and column \c c at index
+  \c r*cols+c. It requires the temporaries of the one-dimensional FFTs of
+  both lengths. Accordingly, code generated with option \c -n
+  \e planes\c x\e rows\c x\e cols works on arrays of size
+  \e planes*\e rows*\e cols holding the volume plane by plane, i.e. the
+  point (\c p,\c r,\c c) at index \c (p*rows+r)*cols+c.
+- Code generated with option \c -N \c B works on the arrays <tt>xr[]</tt> and
+  <tt>xi[]</tt> of size \c n*B holding the \c B signals interleaved, i.e.
+  element \c i of signal \c b at index \c i*B+b.
+- Code generated with option \c -T starts with the definition of the table
+  <tt>tw[]</tt> of the constants, its elements of the type given by option
+  \c -t, which should be the type of the arrays.
+- Code generated with option \c -L is enclosed in a block, which defines the
+  tables <tt>wc[]</tt> and <tt>wf[]</tt> of the cosine and sine values, of the
+  type given by option \c -t, the twiddle factors, and the loop variables. It
+  requires the temporaries <tt>tr</tt> and <tt>ti</tt>, with option \c -u
+  \c 3mul <tt>tk</tt>, and those of the codelet.
+- Code generated with option \c -x requires option \c -e, the function
+  defines the vector temporaries <tt>wr</tt>, <tt>wi</tt>, <tt>ar</tt>,
+  <tt>ai</tt>, <tt>cr</tt>, and <tt>ci</tt> itself. It is preceded by
+  <tt>\#include <immintrin.h></tt>. With \c avx2 the function gets the
+  attribute <tt>__attribute__ ((target (\"avx2,fma\")))</tt> of GCC and
+  Clang, so it compiles without further compiler options, but must be
+  called on processors supporting AVX2 and FMA only. With \c vec\e N the
+  function is preceded by the definitions of the vector type, e.g.
+  <tt>v4df</tt>, and the one with the alignment of the elements, e.g.
+  <tt>v4df_u</tt>, and requires GCC from version 12 on or Clang.
+- Code generated with option \c -c \c interleaved or \c -c \c c99complex
+  works on the one array <tt>x[]</tt> of size \c 2n holding the complex
+  values interleaved, i.e. the real part of element \c k in
+  <tt>x[2k]</tt> and the imaginary part in <tt>x[2k+1]</tt>, which is the
+  layout of C99 \c complex and C++ \c std::complex arrays as well. The
+  function generated with option \c -e takes <tt>x[]</tt>, with
+  \c c99complex the complex array <tt>xc[]</tt> of type \c TYPE
+  \c _Complex, which it accesses through <tt>x[]</tt>.
+- Code generated with option \c -Z requires the arrays <tt>xr[]</tt> and
+  <tt>xi[]</tt> to be of size \c L, the smallest power of two with
+  \c L>=n+m-1, \c m being the number of bins. The input values are taken from
+  the first \c n elements, the bins are stored in the first \c m elements. It
+  requires the temporaries <tt>tr</tt>, <tt>ti</tt>, <tt>ur</tt>, <tt>ui</tt>,
+  <tt>vr</tt>, and <tt>vi</tt>.
 
 Advantage of this approach is that no assumption is required for the generated
 code regarding the concrete type of the involved variables. The arrays and
 variables can therefore be of any valid floating point type, e.g. \c double or
-\c float.
+\c float. Only options \c -T and \c -L fix the type.
 
 The generated code can easiest be integrated if it is piped to a file which is
 then included via an \c \#include preprocessor statement into a function body
@@ -282,12 +794,41 @@ program must
 - In case of an inverse FFT the results must be divided by \c n the number of
   the data points.
 
+With option \c -e the program generates such a function itself, e.g.
+<tt>fftGen -n 32 -e fft -t float</tt> writes
+\code
+void  fft (float *restrict xr, float *restrict xi)
+{
+    float  tr, ti;
+
+    ...
+}
+\endcode
+The arrays are passed as parameters, <tt>xr_in[]</tt> and <tt>xi_in[]</tt>
+before <tt>xr[]</tt> and <tt>xi[]</tt> with options \c -k and \c -p, the
+former as pointers to \c const, the one array <tt>x[]</tt> with options
+\c -f, \c -C, \c -D, \c -M, and \c -c \c interleaved, the complex array
+<tt>xc[]</tt> with option \c -c \c c99complex. The temporaries used by the
+code are local variables, the work arrays of option \c -k as well. The
+\c restrict qualifiers require C99, for C++ they may be defined as
+\c __restrict. The alignment hints of option \c -A require GCC or Clang.
+
 
 
 \section Options  OPTIONS
 
 \par \c -n, \c \-\-points \e number
-Number of data points of the FFT. The number must be a power of two.\n
+Number of data points of the FFT. The number must be a product of the prime
+factors 2, 3, 5, and 7, or a prime \c p with \c p-1 being such a product.
+Options \c -r, \c -o, \c -m, \c -s, \c -R, \c -S, \c -d, \c -b, \c -k,
+\c -p, \c -L, and \c -x require a power of two, options \c -f, \c -C, and
+\c -D an even number, option \c -M a multiple of 4.\n
+Given as \e rows\c x\e cols, e.g. \c 16x32, the option specifies the numbers
+of rows and columns of a two-dimensional FFT, given as
+\e planes\c x\e rows\c x\e cols, e.g. \c 32x32x32, the numbers of planes,
+rows, and columns of a three-dimensional FFT, each of them subject to the above
+restrictions. This cannot be combined with options \c -m, \c -s, \c -k,
+\c -f, \c -C, \c -D, \c -M, or \c -Z.\n
 This option is not optional. It must be given to specify the required number of
 data points.
 
@@ -314,6 +855,161 @@ Optimize the code assuming that the FFT input sequence is symmetrical to element
 n/2 if n is the number of data points passed with option \c -n (indices starting
 at 0), see \ref Optimizations.
 
+\par \c -R, \c \-\-radix \e number
+Radix of the butterflies, either 2 (the default) or 4. See \ref Optimizations.
+
+\par \c -S, \c \-\-split-radix
+Use the split-radix algorithm. Can't be combined with option \c -R. See
+\ref Optimizations.
+
+\par \c -d, \c \-\-dif
+Use decimation in frequency, i.e. the bit reversal permutation is conducted at
+the end of the transform. Can't be combined with options \c -R or \c -S. See
+\ref Optimizations.
+
+\par \c -b, \c \-\-no-bitrev
+Omit the bit reversal permutation. The output sequence is left in bit reversed
+order in combination with option \c -d, otherwise the input sequence is
+expected in bit reversed order. See \ref Optimizations.
+
+\par \c -k, \c \-\-stockham
+Use the Stockham autosort algorithm, which works out of place. Can't be combined
+with options \c -R, \c -S, \c -d, or \c -b. See \ref Optimizations and
+\ref Integration.
+
+\par \c -p, \c \-\-out-of-place
+Read the input sequence from the arrays <tt>xr_in[]</tt> and <tt>xi_in[]</tt>,
+which are not modified, and write the result to <tt>xr[]</tt> and
+<tt>xi[]</tt>. Requires a number of points being a power of two, and cannot be
+combined with options \c -d, \c -k, \c -f, \c -C, \c -D, \c -M, \c -Z,
+\c -L, \c -c, or \c -n \e rows\c x\e cols. See \ref Optimizations and
+\ref Integration.
+
+\par \c -I, \c \-\-istride \e stride
+\par \c -O, \c \-\-ostride \e stride
+Stride of the elements of the input and the output sequence, either a positive
+number or the name of a variable, default 1. With options \c -p and \c -k the
+input is read from <tt>xr_in[]</tt> and <tt>xi_in[]</tt> with the stride of
+option \c -I, and the output is written to <tt>xr[]</tt> and <tt>xi[]</tt>
+with the stride of option \c -O. Otherwise the one given or both, which must
+then be equal, apply to <tt>xr[]</tt> and <tt>xi[]</tt>. A name must not
+collide with a keyword or an identifier of the generated code. Cannot be
+combined with options \c -f, \c -C, \c -D, \c -M, \c -Z, \c -N, \c -L,
+\c -x, \c -c, or \c -n \e rows\c x\e cols. See \ref Optimizations and
+\ref Integration.
+
+\par \c -f, \c \-\-real-fft
+Generate code for the FFT of real values in one array by a complex FFT of half
+the length. Together with option \c -i generate code for the inverse transform
+resulting in real values. See \ref Optimizations and \ref Integration.
+
+\par \c -C, \c \-\-dct2
+Generate code for the DCT-II of real values in one array. The number of points
+must be even. Option \c -C can be combined with options \c -R and \c -S only.
+See \ref Optimizations and \ref Integration.
+
+\par \c -D, \c \-\-dct3
+Generate code for the DCT-III, the inverse of the DCT-II, of real values in one
+array. The number of points must be even. Option \c -D can be combined with
+options \c -R and \c -S only. See \ref Optimizations and \ref Integration.
+
+\par \c -M, \c \-\-mdct
+Generate code for the MDCT of real values in one array, together with option
+\c -i for the IMDCT. The number of points, i.e. the length of the blocks, must
+be a multiple of 4. Option \c -M can be combined with options \c -i, \c -R,
+\c -S, and \c -w only. See \ref Optimizations and \ref Integration.
+
+\par \c -w, \c \-\-sine-window
+Apply the sine window to the input of the MDCT or the output of the IMDCT
+generated with option \c -M. The window values are merged into the constants
+of the code. See \ref Optimizations.
+
+\par \c -Z, \c \-\-bluestein
+Generate code for the chirp z-transform by the Bluestein algorithm. This works
+for any number of points. Option \c -Z cannot be combined with options \c -r,
+\c -o, \c -m, \c -s, \c -R, \c -S, \c -d, \c -b, \c -k, or \c -f. See
+\ref Optimizations and \ref Integration.
+
+\par \c -B, \c \-\-bins \e number
+Number of frequency bins computed by the code generated with option \c -Z.
+Default is the number of points.
+
+\par \c -F, \c \-\-start-bin \e number
+Frequency of the first bin computed by the code generated with option \c -Z,
+in units of the bin spacing of the DFT. It may be any floating point value.
+Default is zero.
+
+\par \c -W, \c \-\-bin-spacing \e number
+Spacing of the bins computed by the code generated with option \c -Z, in units
+of the bin spacing of the DFT. It may be any floating point value. Default is
+one.
+
+\par \c -K, \c \-\-block \e number
+Number of adjacent columns transformed together by the code for a two- or
+three-dimensional FFT. Default is zero, i.e. the row-column mode transforming one
+column after the other. Requires option \c -n \e rows\c x\e cols or
+\e planes\c x\e rows\c x\e cols with the numbers of rows and planes being
+powers of two. See \ref Optimizations.
+
+\par \c -N, \c \-\-batch \e number
+Number of interleaved signals transformed by the generated code. Default is
+zero, which is the same as one, i.e. a single signal. Cannot be combined with
+options \c -k, \c -f, \c -C, \c -D, \c -M, \c -Z, or \c -n
+\e rows\c x\e cols. See \ref Optimizations and \ref Integration.
+
+\par \c -e, \c \-\-function \e name
+Generate a complete function with the given name, taking the arrays as
+\c restrict qualified pointers and defining the temporaries it uses as local
+variables. See \ref Optimizations and \ref Integration.
+
+\par \c -t, \c \-\-type \e type
+Type of the array elements and the temporaries of the function generated with
+option \c -e, and of the tables of options \c -T and \c -L. Default is
+\c double.
+
+\par \c -A, \c \-\-align \e number
+Alignment of the arrays in bytes, a power of two. The function generated with
+option \c -e declares the arrays being aligned to it by
+<tt>__builtin_assume_aligned()</tt>. Default is zero, i.e. no assumption.
+
+\par \c -T, \c \-\-twiddle-table
+Store the constants in the table <tt>tw[]</tt> instead of writing them as
+literal constants. See \ref Optimizations and \ref Integration.
+
+\par \c -L, \c \-\-codelet \e number
+Number of points of the unrolled codelets, a power of two. If the number of
+points of the FFT is greater then only the codelets are unrolled and the
+remaining stages are done by loops. Default is zero, i.e. the whole FFT is
+unrolled. Requires a number of points being a power of two and cannot be
+combined with options \c -r, \c -o, \c -m, \c -s, \c -d, \c -b, \c -k,
+\c -f, \c -C, \c -D, \c -M, \c -Z, \c -N, or \c -n \e rows\c x\e cols.
+See \ref Optimizations and \ref Integration.
+
+\par \c -x, \c \-\-simd \e name
+Write the radix-2 stages with the intrinsics of the SIMD instruction set
+\e name, either \c sse2 or \c avx2, the latter with FMA, or with
+\c vec\e N of the vector extensions of GCC and Clang with vectors of \e N
+bytes, a power of two for 2 to 16 elements. Requires option \c -e with type \c double
+or \c float and a number of points being a power of two, and cannot be
+combined with options \c -r, \c -o, \c -m, \c -s, \c -R \c 4, \c -S,
+\c -d, \c -k, \c -f, \c -C, \c -D, \c -M, \c -Z, \c -N, \c -L, or
+\c -n \e rows\c x\e cols. See \ref Optimizations and \ref Integration.
+
+\par \c -c, \c \-\-layout \e layout
+Layout of the complex values: \c split, the default, for the arrays
+<tt>xr[]</tt> and <tt>xi[]</tt>, \c interleaved for the one array
+<tt>x[]</tt> of alternating real and imaginary parts, or \c c99complex for
+the same layout with the function of option \c -e taking a C99 complex
+array. Cannot be combined with options \c -k, \c -f, \c -C, \c -D, \c -M,
+\c -L, or \c -x. See \ref Optimizations and \ref Integration.
+
+\par \c -u, \c \-\-cmul \e form
+Form of the multiplications by the twiddle factors: \c plain, the default,
+with four multiplications, \c fma with calls of \c fma(), \c fmaf(), or
+\c fmal() for types \c double, \c float, or <tt>long double</tt>, \c 3mul
+with three multiplications, or \c ratio with the ratio of the parts of the
+twiddle factor. See \ref Optimizations and \ref Integration.
+
 \par \c -l, \c \-\-license
 Write a short GPL 3 license note at the beginning of the generated code.
 
@@ -350,13 +1046,83 @@ Wrong command line argument or option. See \ref Synopsis or \ref Options.
 \par \"Error allocating memory\"
 Not enough heap memory available. It might help to close some applications.
 
+\par \"Error creating temporary file\"
+The code of the function generated with option \c -e is collected in a
+temporary file, which could not be created.
+
 \par \"No number of points specified\"
-The number of points must be specified using option \c -n. It must be a power of
-two. See \ref Synopsis or \ref Options.
+The number of points must be specified using option \c -n. See \ref Synopsis or
+\ref Options.
+
+\par \"Number of points is not supported\"
+The number of data points specified with option \c -n must be a product of the
+prime factors 2, 3, 5, and 7, or a prime \c p with \c p-1 being such a product.
+With options \c -f, \c -C, and \c -D this applies to half the number of data
+points, with option \c -M to a quarter, for a two- or three-dimensional FFT to
+the numbers of points of each dimension. See
+\ref Description or \ref Options.
 
-\par \"Number of points is not a power of two\"
-The number of data points specified with option \c -n must be a power of two.
-See \ref Description or \ref Options.
+\par \"Options require a number of points being a power of two\"
+\par \"Options require an even number of points\"
+\par \"Option requires a number of points being a multiple of 4\"
+\par \"Option requires numbers of rows and planes being powers of two\"
+The specified options cannot be applied to the number of data points. See
+\ref Options.
+
+\par \"Radix is not supported\"
+The radix specified with option \c -R must be 2 or 4. See \ref Options.
+
+\par \"Number of bins is not supported\"
+The number of bins specified with option \c -B must not be negative.
+
+\par \"Block size is not supported\"
+The block size specified with option \c -K must not be negative.
+
+\par \"Number of signals is not supported\"
+The number of signals specified with option \c -N must not be negative.
+
+\par \"Codelet size is not supported\"
+The number of points of the codelets specified with option \c -L must be a
+power of two greater than one.
+
+\par \"SIMD instruction set is not supported\"
+The SIMD instruction set specified with option \c -x must be \c sse2,
+\c avx2, or \c vec\e N.
+
+\par \"Layout is not supported\"
+The layout specified with option \c -c must be \c split, \c interleaved, or
+\c c99complex.
+
+\par \"Stride is not supported\"
+The strides specified with options \c -I and \c -O must be positive numbers or
+names of variables.
+
+\par \"Name of the stride is reserved\"
+The name of a variable given as stride by option \c -I or \c -O must not be a
+keyword of C, the name of an array or a temporary of the generated code, e.g.
+\c xr or \c tr, or the name of the function of option \c -e.
+
+\par \"Form of the complex multiplications is not supported\"
+The form specified with option \c -u must be \c plain, \c fma, \c 3mul, or
+\c ratio.
+
+\par \"Vector size is not supported\"
+The size \e N of the vectors specified with option \c -x \c vec\e N must be a
+power of two and hold 2 to 16 elements.
+
+\par \"Alignment is not supported\"
+The alignment specified with option \c -A must be a power of two.
+
+\par \"Options cannot be combined\"
+\par \"Options require option -Z\"
+\par \"Option requires option -M\"
+\par \"Option requires option -n ROWSxCOLS\"
+\par \"Option requires option -e\"
+\par \"Option requires option -e, -T, or -L\"
+\par \"Option requires type double or float\"
+\par \"Option requires type double, float, or long double\"
+\par \"Different strides require option -p or -k\"
+Some options exclude each other or require another option. See \ref Options.
 
 
 
@@ -394,9 +1160,11 @@ this program, see file COPYING. If not, see https://www.gnu.org/licenses/.
 
 #include  <stdio.h>
 #include   <math.h>     // sin(),cos(),fabs()
-#include <string.h>     // strlen(),strcat(),strncpy(),strcmp(),strerror()
-#include <stdlib.h>     // malloc(),exit(),free(),EXIT_SUCCESS,EXIT_FAILURE,NULL
+#include <string.h>     // strlen(),strcat(),strncpy(),strcmp(),strspn(),strerror()
+#include <stdlib.h>     // malloc(),realloc(),exit(),free(),EXIT_SUCCESS,EXIT_FAILURE,NULL
 #include  <errno.h>     // errno
+#include <stdarg.h>     // va_list,va_start(),va_end()
+#include  <ctype.h>     // isalnum(),isdigit()
 
 #define  LOGO       "fftGen"
 #define  VERSION    "V1"
@@ -417,7 +1185,202 @@ this program, see file COPYING. If not, see https://www.gnu.org/licenses/.
 //------------------------------------------------------------------------------
 // Definitions and Declarations
 
-static void  fftGen (int,int,int,int,int,int);  // Generating function
+static void  fftGen (int,int,int,int,int,int,int,int,int,int,int); // Gen. fn.
+static void  genFft2d (int,int,int,int,int,int,int,int,int,int);
+static void  genFft3d (int,int,int,int,int,int,int,int,int,int,int);
+static void  genBatch (int,int,int,int,int,int,int,int,int,int,int);
+static void  genHybrid (int,int,int,int,int,const char*);
+static void  genHybridTwiddle (int,int);
+static void  genFunction (const char*,const char*,int,int,int,int,int);
+static void  genOut (const char*,...);
+static void  genTable (const char*,const char*);
+static void  genCopy (FILE*,const char*);
+static void  genRealFft (int,int,int,int,int);
+static void  genRealPre (int);
+static void  genRealPost (int);
+static void  genDct (int,int,int,int);
+static void  genDctPost (int);
+static void  genDctPre (int,const int*);
+static void  genMdct (int,int,int,int,int);
+static void  genRealPermutation (int,const int*);
+static void  genRader (void);
+static void  genBluestein (int,int,int,double,double);
+static void  genPrimeFactor (void);
+static void  genMixedRadix (int);
+static void  genPermutation (const int*,const double*,const double*);
+static void  genPrimeButterfly (int,const int*,int,int,int);
+static void  genBitRev (int,int,int);
+static void  genGather (int);
+static void  genBitRevOut (void);
+static void  genSymmIn (int);
+static void  genTwiddle (const char*,const char*,const char*,int,const char*,int,
+                         double,double,int,int*,int*);
+static void  genScaledSum (const char*,double,const char*,double,const char*);
+static void  genButterfly (int,int,const char*,const char*,int,int,int,int);
+static void  genRadix4 (int,int,double,int);
+static void  genLButterfly (int,int,double,int,int);
+static void  genSplitRadix (int,int,int);
+static void  genDifButterfly (int,int,double,double,int);
+static void  genStockham (void);
+static void  genSimdStage (int);
+static void  genSimdRegStages (void);
+static int   genBlock (int);
+static int   genSum (const char*,const char*,int,char,const char*,int);
+static void  genLinComb (const char*,int,const double*,const char*const*);
+static const char  *elem (const char*,int);
+static const char  *realElem (int);
+static const char  *constant (double);
+static const char  *vOp (const char*,const char*,const char*);
+static const char  *vLoad (const char*);
+static void  vStore (const char*,const char*);
+static const char  *vSet (const double*);
+static const char  *vFma (const char*,const char*,const char*,const char*);
+static const char  *vShuffle (int,int,const char*);
+static int   bitRev (int,int);
+static int   digitRev (int,const int*);
+static void  inputOrder (int,int*);
+static int   factorize (int,int*);
+static int   coprimeFactors (int,int*);
+static int   isPrime (int);
+
+#define  LINELEN   200          // Maximum length of a generated code line
+
+                                // Layouts of the complex values, see option -c
+#define  SPLIT          0       // Arrays xr[] and xi[]
+#define  INTERLEAVED    1       // One array x[], x[2k]=xr[k], x[2k+1]=xi[k]
+#define  C99COMPLEX     2       // The same, viewing the C99 complex array xc[]
+
+static const char *const  layoutNames[] = {"split", "interleaved", "c99complex",
+                                           NULL};
+
+                                // Forms of the complex multiplications by the
+                                // twiddle factors, see option -u
+#define  CMUL_PLAIN     0       // 4 multiplications, 2 additions
+#define  CMUL_FMA       1       // 2 multiplications, 2 calls of fma()
+#define  CMUL_THREE     2       // 3 multiplications, 3 additions
+#define  CMUL_RATIO     3       // The same as CMUL_FMA after contraction
+
+static const char *const  cmulNames[] = {"plain", "fma", "3mul", "ratio", NULL};
+
+                                // Names a stride variable must not have, the
+                                // keywords of C and the identifiers of the code
+static const char *const  reservedNames[] = {
+    "auto", "break", "case", "char", "const", "continue", "default", "do",
+    "double", "else", "enum", "extern", "float", "for", "goto", "if", "inline",
+    "int", "long", "register", "restrict", "return", "short", "signed",
+    "sizeof", "static", "struct", "switch", "typedef", "union", "unsigned",
+    "void", "volatile", "while", "_Bool", "_Complex", "_Imaginary",
+    "tr", "ti", "ur", "ui", "vr", "vi", "tk", "br", "bi", "yr", "yi",
+    "x", "xc", "xr", "xi", "xr_in", "xi_in", "wc", "wf", "tw", "fma", "fmaf",
+    "fmal",
+    NULL
+};
+
+
+//------------------------------------------------------------------------------
+// Descriptor of a SIMD instruction set the code can be generated for
+
+typedef
+    struct SimdSt {
+            const char  *name;  // Name of the instruction set, see option -x
+            const char  *prefix;// Prefix of the intrinsics, NULL for the
+                                // vector extensions of GCC and Clang
+            int          bytes; // Size of the vectors in bytes
+            int          fma;   // Flag: !=0: Fused multiply-add available
+            const char  *target;// If !=NULL: Target attribute of the function
+            const char  *shuffle[2][3][2];  // Formats of the shuffles of the
+                                // vectors of double and float, see vShuffle()
+        }
+            SIMD;
+
+static const SIMD  simdSets[] = {
+    {"sse2", "_mm", 16, 0, NULL,
+     {{{NULL, NULL}},
+      {{"_mm_shuffle_ps (%s, %s, 0xA0)", "_mm_shuffle_ps (%s, %s, 0xF5)"},
+       {"_mm_movelh_ps (%s, %s)", "_mm_movehl_ps (%s, %s)"}}}},
+    {"avx2", "_mm256", 32, 1, "avx2,fma",
+     {{{"_mm256_unpacklo_pd (%s, %s)", "_mm256_unpackhi_pd (%s, %s)"},
+       {"_mm256_permute4x64_pd (%s, 0x44)", "_mm256_permute4x64_pd (%s, 0xEE)"}},
+      {{"_mm256_moveldup_ps (%s)", "_mm256_movehdup_ps (%s)"},
+       {"_mm256_shuffle_ps (%s, %s, 0x44)", "_mm256_shuffle_ps (%s, %s, 0xEE)"},
+       {"_mm256_permute2f128_ps (%s, %s, 0x00)",
+        "_mm256_permute2f128_ps (%s, %s, 0x11)"}}}},
+    {NULL, NULL, 0, 0, NULL, {{{NULL}}}}
+};
+
+
+//------------------------------------------------------------------------------
+// State of the code generation shared by the code generating functions
+
+typedef
+    struct GenSt {
+            int     n;          // Number of points
+            int     inv;        // Flag: !=0: inverse FFT
+            int     realIn;     // Flag: !=0: Optimize for real only input
+            int     realOut;    // Flag: !=0: Optimize for real only output
+            int     symmIn;     // Flag: !=0: Optimize for symmetry at input
+            int     symmOut;    // Flag: !=0: Optimize for symmetry at output
+            int     realView;   // Flag: !=0: Sequence elements xr[k] and xi[k]
+                                // are stored in x[2k] and x[2k+1], see elem()
+            int     outOfPlace; // Flag: !=0: The input is read from xr_in and
+                                // xi_in, see genGather()
+            const char *istride;// If !=NULL: Stride of the elements of xr_in
+                                // and xi_in, a number or the name of a
+                                // variable, see elem()
+            const char *ostride;// The same for the elements of xr and xi
+            int     cmul;       // Form of the complex multiplications, see
+                                // genTwiddle()
+            const char *fma;    // Name of the fma() function for the type
+            int     offset;     // Sequence element k is stored at index
+                                // k*stride+offset, see elem()
+            int     stride;     // Distance of the sequence elements
+            int     block;      // Number of sequences at the offsets offset,
+                                // offset+1, ... transformed together, see
+                                // genBlock()
+            const char *base;   // If !=NULL: Name of a variable added to the
+                                // indices of xr and xi, see genHybrid()
+            int     nIn;        // If !=0: The input elements nIn...n-1 are
+                                // known to be zero, see genBluestein()
+            const int *map;     // If !=NULL: Sequence element k is stored at
+                                // index map[k]*stride+offset, see
+                                // genPrimeFactor()
+            int    *nzr;        // To keep track of xr[i] being zero, analogous
+                                // to nzi. Used for decimation in frequency.
+            int    *nzi;        // To keep track of xi[i] being zero at realIn
+                                // optimization. If xi[i]!=0 then nzi[i]==1.
+            double  eps;        // Limits to detect sine and cosine function
+            double  epsOne;     //   values being zero, one, or minus one
+            double  epsMOne;
+            FILE   *out;        // Stream the generated code is written to,
+                                // see genOut()
+            int     table;      // Flag: !=0: Constants are stored in the table
+                                // tw[], see constant()
+            const SIMD *simd;   // If !=NULL: Instruction set of the vectors of
+                                // adjacent butterflies, see genSimdStage()
+            int     lanes;      // Number of elements of a vector
+            char    vtype[16];  // Type of the vectors, e.g. __m128d
+            const char *suffix; // Suffix of the intrinsics, "pd" or "ps"
+            const char *const (*shuffle)[2];// Shuffles for the type of the
+                                // vectors, see vShuffle()
+        }
+            GEN;
+
+static GEN  gen = {.stride = 1, .block = 1};
+
+
+//------------------------------------------------------------------------------
+// Table of the constants with option -T, kept apart from gen, which is saved
+// and restored by the code generating functions
+
+typedef
+    struct TableSt {
+            char  (*val)[32];   // Values formatted according to NUMBER_FORMAT
+            int     n;          // Number of values
+            int     size;       // Allocated number of values
+        }
+            TABLE;
+
+static TABLE  tw;
 
 
 static char licenseText[] =
@@ -434,8 +1397,6 @@ static char licenseText[] =
 "// You should have received a copy of the GNU General Public License along with\n"
 "// this program, see file COPYING. If not, see https://www.gnu.org/licenses/.\n"
 ;
-static char header[] = "";          // Starting code of the generated function
-static char footer[] = "";          // Ending of the generated function
 
 
 //------------------------------------------------------------------------------
@@ -464,7 +1425,24 @@ int  main (
     const int    argc,
     const char  *argv[]
 ) {
-    static int  n;       // Number of points for the FFT, must be a power of two
+    static int  n;       // Number of points for the FFT, 2^a*3^b*5^c*7^d,
+                         // the number of rows of a two-dimensional FFT, the
+                         // number of planes of a three-dimensional FFT
+    static int  rows;    // Number of rows of a three-dimensional FFT, or 0
+    static int  cols;    // Number of columns of a two- or three-dimensional
+                         // FFT, or 0
+    static const char  *points;     // Argument of option -n
+    static int  block;   // Number of columns transformed together, 0: one
+    static int  batch;   // Number of interleaved signals, 0: one
+    static const char  *function;   // Name of the generated function, or NULL
+    static const char  *type = "double";// Type of the array elements
+    static int  align;   // Alignment of the arrays in bytes, 0: unknown
+    static int  table;   // Flag: !=0: Store the constants in a table
+    static int  codelet; // Number of points of the unrolled codelets, 0: all
+    static const char  *simdName;   // Name of the SIMD instruction set, or NULL
+    const SIMD  *simd = NULL;       // SIMD instruction set, or NULL
+    static const char  *layoutName; // Name of the layout of the complex values
+    int  layout = SPLIT;            // Layout of the complex values
     static int  inv;     // Flag: !=0: Generate code for inverse FFT
     static int  realIn;  // Flag: !=0: Optimize for real only input
     static int  realOut; // Flag: !=0: Optimize for real only output
@@ -472,15 +1450,62 @@ int  main (
     static int  symmOut; // Flag: !=0: Optimize for symmetry at output
     static int  verbose; // Level of verbosity
     static int  license; // Flag: !=0: Write a GPL 3 note at the beginning
+    static int  radix=2; // Radix of the butterflies, 2 or 4
+    static int  split;   // Flag: !=0: Use the split-radix algorithm
+    static int  dif;     // Flag: !=0: Use decimation in frequency
+    static int  noBitRev;// Flag: !=0: Omit the bit reversal permutation
+    static int  stockham;// Flag: !=0: Use the Stockham autosort algorithm
+    static int  outOfPlace;// Flag: !=0: Read the input from xr_in and xi_in
+    static const char  *istride;    // Stride of the input elements, or NULL
+    static const char  *ostride;    // Stride of the output elements, or NULL
+    static const char  *cmulName;   // Name of the form of the complex
+                                    // multiplications, or NULL
+    int  cmul = CMUL_PLAIN;         // Form of the complex multiplications
+    static int  realFft; // Flag: !=0: Generate a real FFT on one real array
+    static int  dct2;    // Flag: !=0: Generate a DCT-II on one real array
+    static int  dct3;    // Flag: !=0: Generate a DCT-III on one real array
+    static int  mdct;    // Flag: !=0: Generate an MDCT on one real array
+    static int  window;  // Flag: !=0: Apply the sine window of the MDCT
+    static int  bluestein;// Flag: !=0: Use the Bluestein algorithm
+    static int  bins;    // Number of frequency bins, 0: n
+    static double  startBin;        // Frequency of the first bin
+    static double  binSpacing = 1.; // Frequency spacing of the bins
 #define  MAXOPT    50    // Must be greater than maximum length of short or
                          // long option strings (w/o parameter, including \0)
     static const OPTION  pOptions[] = {
-        {"n", "-points"      , "%i", &n      },
+        {"n", "-points"      , "%s", &points },
         {"i", "-inverse"     , NULL, &inv    },
         {"r", "-real-in-opt" , NULL, &realIn },
         {"o", "-real-out-opt", NULL, &realOut},
         {"m", "-symm-in-opt" , NULL, &symmIn },
         {"s", "-symm-out-opt", NULL, &symmOut},
+        {"R", "-radix"       , "%i", &radix  },
+        {"S", "-split-radix" , NULL, &split  },
+        {"d", "-dif"         , NULL, &dif    },
+        {"b", "-no-bitrev"   , NULL, &noBitRev},
+        {"k", "-stockham"    , NULL, &stockham},
+        {"p", "-out-of-place", NULL, &outOfPlace},
+        {"I", "-istride"     , "%s", &istride},
+        {"O", "-ostride"     , "%s", &ostride},
+        {"f", "-real-fft"    , NULL, &realFft},
+        {"C", "-dct2"        , NULL, &dct2   },
+        {"D", "-dct3"        , NULL, &dct3   },
+        {"M", "-mdct"        , NULL, &mdct   },
+        {"w", "-sine-window" , NULL, &window },
+        {"Z", "-bluestein"   , NULL, &bluestein},
+        {"B", "-bins"        , "%i", &bins   },
+        {"F", "-start-bin"   , "%lf", &startBin},
+        {"W", "-bin-spacing" , "%lf", &binSpacing},
+        {"K", "-block"       , "%i", &block  },
+        {"N", "-batch"       , "%i", &batch  },
+        {"e", "-function"    , "%s", &function},
+        {"t", "-type"        , "%s", &type   },
+        {"A", "-align"       , "%i", &align  },
+        {"T", "-twiddle-table", NULL, &table },
+        {"L", "-codelet"     , "%i", &codelet},
+        {"x", "-simd"        , "%s", &simdName},
+        {"c", "-layout"      , "%s", &layoutName},
+        {"u", "-cmul"        , "%s", &cmulName},
         {"l", "-license"     , NULL, &license},
         {"v", "-verbose"     , NULL, &verbose},
         {NULL, NULL          , NULL, NULL    }
@@ -540,8 +1565,90 @@ int  main (
         }
     }
 
+    // Number of points, either N, ROWSxCOLS, or PLANESxROWSxCOLS
+    if (points) {
+        int  len = 0;
+        if (sscanf (points, "%dx%dx%d%n", &n, &rows, &cols, &len) != 3  ||  points[len]) {
+            rows = 0;
+            if (sscanf (points, "%dx%d%n", &n, &cols, &len) != 2  ||  points[len]) {
+                cols = 0;
+                if (sscanf (points, "%i%n", &n, &len) != 1  ||  points[len]) {
+                    fprintf (stderr, "\n"LOGO": Invalid option argument %s\n\n", points);
+                    info (stderr);
+                }
+            }
+        }
+    }
+
+    // Layout of the complex values
+    if (layoutName) {
+        for (layout=0; layoutNames[layout]  &&  strcmp (layoutNames[layout],
+                                                        layoutName); ++layout)  ;
+        if ( ! layoutNames[layout]) {
+            fprintf (stderr, "\n"LOGO": Layout %s is not supported.\n", layoutName);
+            info (stderr);
+        }
+    }
+
+    // Form of the complex multiplications
+    if (cmulName) {
+        for (cmul=0; cmulNames[cmul]  &&  strcmp (cmulNames[cmul], cmulName); ++cmul)  ;
+        if ( ! cmulNames[cmul]) {
+            fprintf (stderr, "\n"LOGO": Form %s of the complex multiplications is not"
+                             " supported.\n", cmulName);
+            info (stderr);
+        }
+    }
+
+    // Strides, each a positive number or the name of a variable
+    for (i=0; i<2; ++i) {
+        const char *const  stride = i ? ostride : istride;
+        int  k;
+        if ( ! stride)  continue;
+        for (k=0; isalnum (stride[k])  ||  stride[k] == '_'; ++k)  ;
+        if (   stride[k]  ||  k == 0
+            || (isdigit (stride[0])  &&  strspn (stride, "0123456789") != (size_t)k)
+            || (isdigit (stride[0])  &&  atoi (stride) < 1)) {
+            fprintf (stderr, "\n"LOGO": Stride %s is not supported.\n", stride);
+            info (stderr);
+        }
+        for (k=0; reservedNames[k]  &&  strcmp (reservedNames[k], stride); ++k)  ;
+        if (reservedNames[k]  ||  (function  &&  ! strcmp (function, stride))) {
+            fprintf (stderr, "\n"LOGO": Name %s of the stride is reserved.\n",
+                             stride);
+            info (stderr);
+        }
+    }
+
+    // SIMD instruction set
+    if (simdName) {
+        static SIMD  vec;   // Vector extensions, the size given by the name
+        int  len = 0;
+
+        for (simd=simdSets; simd->name  &&  strcmp (simd->name, simdName); ++simd)  ;
+        if (   ! simd->name  &&  sscanf (simdName, "vec%d%n", &vec.bytes, &len) == 1
+            && ! simdName[len]) {
+            vec.name = simdName;
+            simd = &vec;
+        }
+        if ( ! simd->name) {
+            fprintf (stderr, "\n"LOGO": SIMD instruction set %s is not supported.\n",
+                     simdName);
+            info (stderr);
+        }
+    }
+
+    // Number of points of the complex transform
+    const int  nc = (realFft || dct2 || dct3) && n > 1 ? n/2 : mdct ? n/4 : n;
+
     if (verbose > 0) {
-        fprintf (stderr, "Number of points %d\n", n);
+        if (rows) {
+            fprintf (stderr, "Number of points %dx%dx%d\n", n, rows, cols);
+        } else if (cols) {
+            fprintf (stderr, "Number of points %dx%d\n", n, cols);
+        } else {
+            fprintf (stderr, "Number of points %d\n", n);
+        }
         if (inv) {
             fprintf (stderr,"Generating code for inverse FFT\n");
         } else {
@@ -559,6 +1666,100 @@ int  main (
         if (symmOut) {
             fprintf (stderr,"Optimize for symmetry at output\n");
         }
+        if (radix != 2) {
+            fprintf (stderr,"Use radix %d butterflies\n", radix);
+        }
+        if (split) {
+            fprintf (stderr,"Use the split-radix algorithm\n");
+        }
+        if (dif) {
+            fprintf (stderr,"Use decimation in frequency\n");
+        }
+        if (noBitRev) {
+            if (dif) {
+                fprintf (stderr,"Leave the output in bit reversed order\n");
+            } else {
+                fprintf (stderr,"Expect the input in bit reversed order\n");
+            }
+        }
+        if (stockham) {
+            fprintf (stderr,"Use the Stockham autosort algorithm\n");
+        }
+        if (outOfPlace) {
+            fprintf (stderr,"Read the input from the arrays xr_in and xi_in\n");
+        }
+        if (istride) {
+            fprintf (stderr,"Use the stride %s for the input elements\n", istride);
+        }
+        if (ostride) {
+            fprintf (stderr,"Use the stride %s for the output elements\n", ostride);
+        }
+        if (block) {
+            fprintf (stderr,"Transform blocks of %d columns together\n", block);
+        }
+        if (batch) {
+            fprintf (stderr,"Transform %d interleaved signals\n", batch);
+        }
+        if (function) {
+            fprintf (stderr,"Generating the function %s for type %s\n",
+                            function, type);
+        }
+        if (align) {
+            fprintf (stderr,"Assume the arrays aligned to %d bytes\n", align);
+        }
+        if (table) {
+            fprintf (stderr,"Store the constants in a table of type %s\n", type);
+        }
+        if (codelet) {
+            fprintf (stderr,"Use unrolled codelets of %d points and loops for the"
+                            " remaining stages\n", codelet);
+        }
+        if (layout == INTERLEAVED) {
+            fprintf (stderr,"Store the complex values interleaved in one array\n");
+        } else if (layout == C99COMPLEX) {
+            fprintf (stderr,"Store the complex values in a C99 complex array\n");
+        }
+        if (cmul == CMUL_FMA) {
+            fprintf (stderr,"Multiply by the twiddle factors using fma()\n");
+        } else if (cmul == CMUL_THREE) {
+            fprintf (stderr,"Multiply by the twiddle factors with 3 multiplications\n");
+        } else if (cmul == CMUL_RATIO) {
+            fprintf (stderr,"Multiply by the twiddle factors in the ratio form\n");
+        }
+        if (simd  &&  simd->prefix) {
+            fprintf (stderr,"Use %s intrinsics for adjacent butterflies\n",
+                            simd->name);
+        } else if (simd) {
+            fprintf (stderr,"Use vectors of %d bytes for adjacent butterflies\n",
+                            simd->bytes);
+        }
+        if (bluestein) {
+            fprintf (stderr,"Use the Bluestein algorithm for %d bins starting at"
+                            " bin %g with spacing %g\n", bins ? bins : n,
+                            startBin, binSpacing);
+        } else if (nc > 7  &&  isPrime (nc)) {
+            fprintf (stderr,"Use Rader's algorithm\n");
+        } else if ((n & (n-1))  &&  coprimeFactors (nc, NULL) > 1) {
+            fprintf (stderr,"Use the prime factor algorithm\n");
+        } else if (n & (n-1)) {
+            fprintf (stderr,"Use mixed-radix butterflies\n");
+        }
+        if (realFft) {
+            fprintf (stderr,"Generating code for a real FFT on one real array\n");
+        }
+        if (dct2) {
+            fprintf (stderr,"Generating code for a DCT-II on one real array\n");
+        }
+        if (dct3) {
+            fprintf (stderr,"Generating code for a DCT-III on one real array\n");
+        }
+        if (mdct) {
+            fprintf (stderr,"Generating code for an %s on one real array\n",
+                            inv ? "IMDCT" : "MDCT");
+        }
+        if (window) {
+            fprintf (stderr,"Apply the sine window\n");
+        }
         if (license) {
             fprintf (stderr,"Include a GPL 3 note into the code\n");
         }
@@ -567,17 +1768,263 @@ int  main (
         fprintf (stderr,"\n"LOGO": No number of points specified.\n");
         info (stderr);
     }
-    if (n & (n-1)) {    // Check n is not a power of two
-        fprintf (stderr,"\n"LOGO": Number of points %d is not a power of two.\n", n);
+    if ((realFft || dct2 || dct3)  &&  n%2  &&  n > 1) {
+        fprintf (stderr,"\n"LOGO": Options -f, -C, and -D require an even number of points.\n");
+        info (stderr);
+    }
+    if ((dct2 || dct3)  &&  (   inv || realIn || realOut || symmIn || symmOut || dif
+                             || noBitRev || stockham || realFft || bluestein
+                             || (dct2 && dct3))) {
+        fprintf (stderr,"\n"LOGO": Options -C and -D cannot be combined with -i, -r, -o, -m,"
+                        " -s, -d, -b, -k, -f, -Z, or each other.\n");
+        info (stderr);
+    }
+    if (mdct  &&  n%4) {
+        fprintf (stderr,"\n"LOGO": Option -M requires a number of points being a multiple of 4.\n");
+        info (stderr);
+    }
+    if (mdct  &&  (   realIn || realOut || symmIn || symmOut || dif || noBitRev
+                   || stockham || realFft || dct2 || dct3 || bluestein)) {
+        fprintf (stderr,"\n"LOGO": Option -M cannot be combined with -r, -o, -m, -s, -d, -b, -k,"
+                        " -f, -C, -D, or -Z.\n");
+        info (stderr);
+    }
+    if (window  &&  ! mdct) {
+        fprintf (stderr,"\n"LOGO": Option -w requires option -M.\n");
+        info (stderr);
+    }
+    if (bluestein  &&  (   realIn || realOut || symmIn || symmOut || radix != 2
+                        || split || dif || noBitRev || stockham || realFft)) {
+        fprintf (stderr,"\n"LOGO": Option -Z cannot be combined with -r, -o, -m, -s,"
+                        " -R, -S, -d, -b, -k, or -f.\n");
+        info (stderr);
+    }
+    if ( ! bluestein  &&  (bins != 0  ||  startBin != 0.  ||  binSpacing != 1.)) {
+        fprintf (stderr,"\n"LOGO": Options -B, -F, and -W require option -Z.\n");
+        info (stderr);
+    }
+    if (cols  &&  (   symmIn || symmOut || stockham || realFft || dct2 || dct3
+                   || mdct || bluestein)) {
+        fprintf (stderr,"\n"LOGO": Option -n ROWSxCOLS cannot be combined with -m, -s, -k,"
+                        " -f, -C, -D, -M, or -Z.\n");
+        info (stderr);
+    }
+    if (block  &&  ! cols) {
+        fprintf (stderr,"\n"LOGO": Option -K requires option -n ROWSxCOLS.\n");
+        info (stderr);
+    }
+    if (block  &&  ((n & (n-1)) || (rows & (rows-1)))) {
+        fprintf (stderr,"\n"LOGO": Option -K requires numbers of rows and planes being powers of two.\n");
+        info (stderr);
+    }
+    if (batch  &&  (   stockham || realFft || dct2 || dct3 || mdct || bluestein
+                    || cols)) {
+        fprintf (stderr,"\n"LOGO": Option -N cannot be combined with -k, -f, -C, -D, -M, -Z,"
+                        " or -n ROWSxCOLS.\n");
+        info (stderr);
+    }
+    if ( ! function  &&  ! table  &&  ! codelet  &&  strcmp (type, "double")) {
+        fprintf (stderr,"\n"LOGO": Option -t requires option -e, -T, or -L.\n");
+        info (stderr);
+    }
+    if ( ! function  &&  align) {
+        fprintf (stderr,"\n"LOGO": Option -A requires option -e.\n");
+        info (stderr);
+    }
+    if (codelet  &&  (   realIn || realOut || symmIn || symmOut || dif || noBitRev
+                      || stockham || realFft || dct2 || dct3 || mdct || bluestein
+                      || batch || cols)) {
+        fprintf (stderr,"\n"LOGO": Option -L cannot be combined with -r, -o, -m, -s, -d, -b,"
+                        " -k, -f, -C, -D, -M, -Z, -N, or -n ROWSxCOLS.\n");
+        info (stderr);
+    }
+    if (simd  &&  (   realIn || realOut || symmIn || symmOut || radix != 2 || split
+                   || dif || stockham || realFft || dct2 || dct3 || mdct
+                   || bluestein || batch || cols || codelet)) {
+        fprintf (stderr,"\n"LOGO": Option -x cannot be combined with -r, -o, -m, -s, -R, -S,"
+                        " -d, -k, -f, -C, -D, -M, -Z, -N, -L, or -n ROWSxCOLS.\n");
+        info (stderr);
+    }
+    if (layout  &&  (stockham || realFft || dct2 || dct3 || mdct || codelet || simd)) {
+        fprintf (stderr,"\n"LOGO": Option -c cannot be combined with -k, -f, -C, -D, -M,"
+                        " -L, or -x.\n");
+        info (stderr);
+    }
+    if (outOfPlace  &&  (   dif || stockham || realFft || dct2 || dct3 || mdct
+                         || bluestein || cols || codelet || layout)) {
+        fprintf (stderr,"\n"LOGO": Option -p cannot be combined with -d, -k, -f, -C, -D, -M,"
+                        " -Z, -L, -c, or -n ROWSxCOLS.\n");
+        info (stderr);
+    }
+    if ((istride || ostride)  &&  (   realFft || dct2 || dct3 || mdct || bluestein
+                                   || cols || batch || codelet || simd || layout)) {
+        fprintf (stderr,"\n"LOGO": Options -I and -O cannot be combined with -f, -C, -D, -M,"
+                        " -Z, -N, -L, -x, -c, or -n ROWSxCOLS.\n");
+        info (stderr);
+    }
+    if (   istride  &&  ostride  &&  strcmp (istride, ostride)
+        && ! outOfPlace  &&  ! stockham) {
+        fprintf (stderr,"\n"LOGO": Different strides of options -I and -O require option -p or -k.\n");
+        info (stderr);
+    }
+    if (   cmul == CMUL_FMA  &&  strcmp (type, "double")  &&  strcmp (type, "float")
+        && strcmp (type, "long double")) {
+        fprintf (stderr,"\n"LOGO": Option -u fma requires type double, float, or long double.\n");
+        info (stderr);
+    }
+    if (simd  &&  ! function) {
+        fprintf (stderr,"\n"LOGO": Option -x requires option -e.\n");
+        info (stderr);
+    }
+    if (simd  &&  strcmp (type, "double")  &&  strcmp (type, "float")) {
+        fprintf (stderr,"\n"LOGO": Option -x requires type double or float.\n");
+        info (stderr);
+    }
+    if (simd  &&  ! simd->prefix) {
+        const int  lanes = simd->bytes / (strcmp (type, "float") ? 8 : 4);
+        if ((simd->bytes & (simd->bytes-1))  ||  lanes < 2  ||  lanes > 16) {
+            fprintf (stderr,"\n"LOGO": Vector size %d is not supported.\n",
+                     simd->bytes);
+            info (stderr);
+        }
+    }
+    if (codelet < 0  ||  codelet == 1  ||  (codelet & (codelet-1))) {
+        fprintf (stderr,"\n"LOGO": Codelet size %d is not supported.\n", codelet);
+        info (stderr);
+    }
+    if (align < 0  ||  (align & (align-1))) {
+        fprintf (stderr,"\n"LOGO": Alignment %d is not supported.\n", align);
+        info (stderr);
+    }
+    if (batch < 0) {
+        fprintf (stderr,"\n"LOGO": Number of signals %d is not supported.\n", batch);
+        info (stderr);
+    }
+    if (block < 0) {
+        fprintf (stderr,"\n"LOGO": Block size %d is not supported.\n", block);
+        info (stderr);
+    }
+    if (bins < 0) {
+        fprintf (stderr,"\n"LOGO": Number of bins %d is not supported.\n", bins);
+        info (stderr);
+    }
+    if ( ! bluestein) {
+        // Check the length of the complex transform being a product of the
+        // prime factors 2, 3, 5, 7, or a prime p with p-1 being such a product
+        // For a two- or three-dimensional FFT check all dimensions
+        const int  dim[3] = {nc, cols, rows};
+        int  f[32], d;
+        for (d=0; d < 3  &&  (d == 0  ||  dim[d]); ++d) {
+            if (   dim[d] < 1  ||  (   factorize (dim[d], f) != 1
+                                  && ! (isPrime (dim[d])  &&  factorize (dim[d]-1, f) == 1))) {
+                fprintf (stderr,"\n"LOGO": Number of points %d is not supported.\n",
+                                d ? dim[d] : n);
+                info (stderr);
+            }
+        }
+    }
+    if (   ((n & (n-1)) || (rows & (rows-1)) || (cols & (cols-1)))
+        && (   realIn || realOut || symmIn || symmOut || radix != 2 || split
+            || dif || noBitRev || stockham || outOfPlace || codelet || simd)) {
+        fprintf (stderr,"\n"LOGO": Options -r, -o, -m, -s, -R, -S, -d, -b, -k,"
+                        " -p, -L, and -x require a number of points being a"
+                        " power of two.\n");
+        info (stderr);
+    }
+    if (radix != 2  &&  radix != 4) {
+        fprintf (stderr,"\n"LOGO": Radix %d is not supported.\n", radix);
+        info (stderr);
+    }
+    if (split  &&  radix != 2) {
+        fprintf (stderr,"\n"LOGO": Options -S and -R cannot be combined.\n");
+        info (stderr);
+    }
+    if (dif  &&  (split  ||  radix != 2)) {
+        fprintf (stderr,"\n"LOGO": Option -d cannot be combined with -S or -R.\n");
+        info (stderr);
+    }
+    if (stockham  &&  (split  ||  radix != 2  ||  dif  ||  noBitRev)) {
+        fprintf (stderr,"\n"LOGO": Option -k cannot be combined with -S, -R, -d, or -b.\n");
+        info (stderr);
+    }
+    if (realFft  &&  (realIn || realOut || symmIn || symmOut || noBitRev || stockham)) {
+        fprintf (stderr,"\n"LOGO": Option -f cannot be combined with -r, -o, -m, -s, -b, or -k.\n");
         info (stderr);
     }
 
     if (license)  fputs (licenseText, stdout);
-    fputs (header, stdout);
 
-    fftGen (n,inv,realIn, realOut, symmIn, symmOut);
+    // With option -e the code is written to a temporary file first, so the
+    // temporaries it uses are known when writing the function header. With
+    // option -T the table of the constants must precede the code.
+    gen.out = stdout;
+    gen.table = table;
+    gen.realView = layout != SPLIT;
+    gen.outOfPlace = outOfPlace;
+    gen.cmul = cmul;
+    gen.fma = ! strcmp (type, "float")       ? "fmaf"
+            : ! strcmp (type, "long double") ? "fmal"
+            :                                  "fma";
+    if (outOfPlace  ||  stockham) {
+        gen.istride = istride;
+        gen.ostride = ostride;
+    } else {
+        gen.istride = gen.ostride = ostride ? ostride : istride;
+    }
+    if (simd) {
+        const int  single = ! strcmp (type, "float");
+        gen.simd   = simd;
+        gen.lanes  = simd->bytes / (single ? 4 : 8);
+        gen.suffix = single ? "ps" : "pd";
+        gen.shuffle = simd->shuffle[single];
+        if (simd->prefix) {
+            snprintf (gen.vtype, sizeof(gen.vtype), "__m%d%s", 8*simd->bytes,
+                      single ? "" : "d");
+        } else {
+            snprintf (gen.vtype, sizeof(gen.vtype), "v%d%s", gen.lanes,
+                      single ? "sf" : "df");
+        }
+    }
+    if (function  ||  table) {
+        gen.out = tmpfile ();
+        if (gen.out == NULL) {
+            fprintf (stderr, "\n"LOGO": Error creating temporary file: %s\n",
+                     strerror(errno));
+            exit (EXIT_FAILURE);
+        }
+    }
+
+    if (bluestein) {
+        genBluestein (n, inv, bins ? bins : n, startBin, binSpacing);
+    } else if (realFft) {
+        genRealFft (n, inv, radix, split, dif);
+    } else if (dct2  ||  dct3) {
+        genDct (n, dct3, radix, split);
+    } else if (mdct) {
+        genMdct (n, inv, radix, split, window);
+    } else if (rows) {
+        genFft3d (n, rows, cols, inv, realIn, realOut, radix, split, dif, noBitRev,
+                  block);
+    } else if (cols) {
+        genFft2d (n, cols, inv, realIn, realOut, radix, split, dif, noBitRev, block);
+    } else if (batch > 1) {
+        genBatch (n, batch, inv, realIn, realOut, symmIn, symmOut, radix, split, dif,
+                  noBitRev);
+    } else if (codelet  &&  n > codelet) {
+        genHybrid (n, codelet, inv, radix, split, type);
+    } else {
+        fftGen (n,inv,realIn, realOut, symmIn, symmOut, radix, split, dif, noBitRev,
+                stockham);
+    }
 
-    fputs (footer, stdout);
+    if (function) {
+        genFunction (function, type, align,
+                     realFft || dct2 || dct3 || mdct || layout == INTERLEAVED,
+                     layout == C99COMPLEX, stockham || outOfPlace, n);
+    } else if (table) {
+        genTable (type, INDENT);
+        genCopy (stdout, "");
+    }
 
     return  EXIT_SUCCESS;
 }
@@ -594,477 +2041,3860 @@ static void  fftGen (
     const int  realIn,        // Flag: !=0: Optimize for real only input
     const int  realOut,       // Flag: !=0: Optimize for real only output
     const int  symmIn,        // Flag: !=0: Optimize for symmetry at input
-    const int  symmOut        // Flag: !=0: Optimize for symmetry at output
+    const int  symmOut,       // Flag: !=0: Optimize for symmetry at output
+    const int  radix,         // Radix of the butterflies, 2 or 4
+    const int  split,         // Flag: !=0: Use the split-radix algorithm
+    const int  dif,           // Flag: !=0: Use decimation in frequency
+    const int  noBitRev,      // Flag: !=0: Omit the bit reversal permutation
+    const int  stockham       // Flag: !=0: Use the Stockham autosort algorithm
 ) {
-#define  LINELEN   200
-    static char  line[LINELEN];
-
-    int     nm,mr,nn,m,k,istep,i,ii,jj;
+    int     nm,nn,m,k,istep,i,ii,jj,b;
     double  a,wr,wi;
 
-    const double  eps = 0.5*sin(M_PI/(n/2));
-    const double  epsOne  =  1.0 - 0.5*(1.0-cos(M_PI/(n/2)));
-    const double  epsMOne = -1.0 + 0.5*(1.0-cos(M_PI/(n/2)));
-
     int  lastKCycle = 0;
+    int  oddStages = 0;     // Flag: Number of radix-2 stages is odd
 
-    typedef
-        struct SwapSt {
-            int  m;         // m and mr will have to be swapped
-            int  mr;
-            int  m_new;     // m value to be used for the source of the
-                            // assignment insted of m at symmIn
-            int  mr_new;    // mr value to be used for the source of the
-                            // assignment insted of mr at symmIn
-            int  symmIn;    // Flag: Use the input symmetry relationship for
-                            // this element
-        } SWAP;
-    SWAP  *swap;
-    int  nSwap;             // Number of swap commands in array swap[]
-
-    // To keep track of xi[i] being zero at realIn optimization.
-    // If xi[i]!=0 then nz[i]==1.
+    int  *nzr = (int*)malloc (sizeof(int)*n);
     int  *nzi = (int*)malloc (sizeof(int)*n);
-    if (nzi == NULL) {
+    if (nzr == NULL  ||  nzi == NULL) {
         fprintf (stderr, "\n"LOGO": Error allocating memory: %s\n", strerror(errno));
         exit (EXIT_FAILURE);
     }
 
+    for (i=0; i<n; ++i)  nzr[i] = 1;
     if ( ! realIn) {
         for (i=0; i<n; ++i)  nzi[i] = 1;
     } else {
         for (i=0; i<n; ++i)  nzi[i] = 0;
     }
+    if (gen.nIn) {
+        for (i=gen.nIn; i<n; ++i)  nzr[i] = nzi[i] = 0;
+    }
+
+    gen.n       = n;
+    gen.inv     = inv;
+    gen.realIn  = realIn;
+    gen.realOut = realOut;
+    gen.symmIn  = symmIn;
+    gen.symmOut = symmOut;
+    gen.nzr     = nzr;
+    gen.nzi     = nzi;
+
+    // Smallest angle between the twiddle factors and the axes of the complex
+    // plane. Unless n is a multiple of 4 this is less than 2*pi/n.
+    a = n%4 ? M_PI/(2*n) : 2.*M_PI/n;
+    gen.eps     = 0.5*sin(a);
+    gen.epsOne  =  1.0 - 0.5*(1.0-cos(a));
+    gen.epsMOne = -1.0 + 0.5*(1.0-cos(a));
+
+    for (k=1; k<n; k*=2)  oddStages = ! oddStages;
 
     nn = n-1;
 
-    //==========================================================================
-    // Implement the binary inversion algorithm
+    if (n > 7  &&  isPrime (n)) {
+        //======================================================================
+        // n is a prime greater than 7: Rader's algorithm
 
-    // 1) Create the array swap[] to store the swapping commands to be conducted
-    //    later.
-    // 2) Fill it with the swapping commands of the binary inversion algorithm.
-    // 3) In case of symmIn create new source indices mr_new according to the
-    //    symmetry relationship x[m]=x*[mr_new=n-mr] (x* being the conjugate
-    //    complex value) if mr > n/2.
-    // 4) Check whether the new source index mr_new would have been overwritten
-    //    already before the current swapping.
-    //    - In that case insert the current swap command in the list before the
-    //      one which would overwrite mr_new.
-    // 5) Conduct the swapping commands in the order as now found in the array.
+        genRader ();
 
-    swap = (SWAP*)malloc (sizeof(SWAP)*n);
-    if (swap == NULL) {
-        fprintf (stderr, "\n"LOGO": Error allocating memory: %s\n", strerror(errno));
-        exit (EXIT_FAILURE);
+        free (nzr);
+        free (nzi);
+        return;
     }
-    for (i=0; i<n; ++i) {
-        swap[i].m = 0;
-        swap[i].mr = 0;
-        swap[i].m_new = 0;
-        swap[i].mr_new = 0;
+
+    if ((n & (n-1))  &&  coprimeFactors (n, NULL) > 1) {
+        //======================================================================
+        // n has coprime factors: Prime factor algorithm
+
+        genPrimeFactor ();
+
+        free (nzr);
+        free (nzi);
+        return;
     }
 
-    //--------------------------------------------------------------------------
-    // Fill swap[] with the binary inversion swap commands and order the
-    // elements such that if the symmetry relationship is to be used the source
-    // elements are not overwritten
+    if (n & (n-1)) {
+        //======================================================================
+        // n is a power of a prime: Mixed radix transform
 
-    mr = 0;
-    for (nSwap=0,m=1; m<=nn; ++m) {
-        k = n;
-        do {
-            k /= 2;
-        } while (mr+k > nn);
-        mr = mr%k + k;
+        genMixedRadix (noBitRev ? 0 : 1);
 
-        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-        // Prepare implementation of "if (mr > m)  SWAP(x[m],x[mr]);"
+        free (nzr);
+        free (nzi);
+        return;
+    }
 
-                    // nSwap is the index of the current swap command in swap[]
-        if (mr > m) {
-            if ( ! symmIn) {
-                swap[nSwap].m = m;             // Swapping according to standard
-                swap[nSwap].mr = mr;           //    binary inversion algorithm
-                swap[nSwap].symmIn = 0;
-            } else {
-                // Optimize assuming input symmetry
-                swap[nSwap].m = m;
-                swap[nSwap].mr = mr;
+    if (stockham) {
+        //======================================================================
+        // Stockham autosort: Out of place transform without bit reversal
 
-                if (m<=n/2 && mr<=n/2) {
-                    swap[nSwap].symmIn = 0;       // No symmetry subst. required
-                } else {
-                    int  i_m  = 0;
-                    int  i_mr = 0;
-                    int  m_new = m;
-                    int  mr_new = mr;
+        genStockham ();
 
-                    if (m  > n/2)  m_new  = n - m ; // Use symmetry relationship
-                    if (mr > n/2)  mr_new = n - mr; //  "
+        free (nzr);
+        free (nzi);
+        return;
+    }
 
-                    swap[nSwap].m_new = m_new;
-                    swap[nSwap].mr_new = mr_new;
-                    swap[nSwap].symmIn = 1;
+    if (dif) {
+        //======================================================================
+        // Decimation in frequency: Do the transform on the sequence in natural
+        // order, then implement the binary inversion algorithm on the result
+
+        if (symmIn)  genSymmIn (0);
+
+        for (k=n/2; k>=1; k/=2) {
+            istep = 2*k;
+            if (k==1)  lastKCycle = 1;
+
+            for (m=0; m<k; ++m) {
+                a  = M_PI*(-m)/k;
+                wr = cos (a);
+                wi = sin (a);
+                if (inv)  wi = -wi;     // Prepare inverse FFT
+                for (ii=m; ii<n; ii+=istep) {
+                    for (b=0; genBlock(b); ++b) {
+                        genDifButterfly (ii, ii+k, wr, wi, lastKCycle);
+                    }
+                }
+            }
+        }
 
-                    // Check whether the array element at the new mr (mr_new)
-                    // would have been assigned already
+        if ( ! noBitRev)  genBitRevOut ();
 
-                    if (m > n/2) {
-                        // Check whether m_new would have been overwritten by a
-                        // writing to element with index m or mr
-                        for (i_m=nSwap-1; i_m>0; --i_m) {
-                            if (m_new == swap[i_m].m || m_new == swap[i_m].mr)  break;
-                        }
-                    }
-                    if (mr > n/2) {
-                        // Check whether mr_new would have been overwritten by a
-                        // writing to element with index m or mr
-                        for (i_mr=nSwap-1; i_mr>0; --i_mr) {
-                            if (mr_new == swap[i_mr].m || mr_new == swap[i_mr].mr)  break;
+        free (nzr);
+        free (nzi);
+        return;
+    }
+
+    //==========================================================================
+    // Decimation in time: Implement the binary inversion algorithm, then do the
+    // transform
+
+    if (gen.outOfPlace) {
+        genGather (noBitRev);
+    } else if ( ! noBitRev) {
+        genBitRev (n, realIn, symmIn);
+    } else if (symmIn) {
+        genSymmIn (1);
+        genOut ("\n");
+    }
+
+    if (split) {
+        genSplitRadix (0, n, realOut);
+    } else {
+        for (k=1; k<n; k=istep) {
+            if (radix == 4  &&  4*k <= n  &&  ! (k == 1  &&  oddStages)) {
+                //--------------------------------------------------------------
+                // Radix-4 stage: Combines the radix-2 stages with distance k
+                // and 2k
+
+                istep = 4*k;
+                if (istep==n)  lastKCycle = 1;
+
+                for (m=0; m<k; ++m) {
+                    a  = M_PI*(-m)/(2*k);
+                    if (inv)  a = -a;       // Prepare inverse FFT
+                    for (ii=m; ii<n; ii+=istep) {
+                        for (b=0; genBlock(b); ++b) {
+                            genRadix4 (ii, k, a, lastKCycle);
                         }
                     }
+                }
+            } else if (   gen.simd  &&  k == 1  &&  gen.lanes > 2
+                       && n >= gen.lanes) {
+                //--------------------------------------------------------------
+                // Radix-2 stages of a distance less than the vector size within
+                // the registers. The single stage of vectors of two lanes is
+                // cheaper as scalar code, which needs no multiplications.
 
-                    // Use the lowest of both and assign it to i_mr
-                    if (i_mr>0 && i_m>0) {
-                        if (i_mr>i_m)  i_mr = i_m;
-                    } else if (i_m>0) {
-                        i_mr = i_m;
-                    }
+                istep = gen.lanes;
+                genSimdRegStages ();
+            } else if (gen.simd  &&  k >= gen.lanes) {
+                //--------------------------------------------------------------
+                // Radix-2 stage on vectors of adjacent butterflies
 
-                    // If the search ended successfully (i.e. before reaching 0)
-                    if (i_mr > 0) {
-                        // The array element at mr_new would have been assigned
-                        // already.
-                        // Create space in array swap[] at index i_mr, firstly
-                        // overwriting swap[nSwap]
-                        for (ii=nSwap; ii>i_mr; --ii) {
-                            swap[ii].m      = swap[ii-1].m ;
-                            swap[ii].mr     = swap[ii-1].mr;
-                            swap[ii].m_new  = swap[ii-1].m_new;
-                            swap[ii].mr_new = swap[ii-1].mr_new;
-                            swap[ii].symmIn = swap[ii-1].symmIn;
+                istep = 2*k;
+                genSimdStage (k);
+            } else {
+                //--------------------------------------------------------------
+                // Radix-2 stage
+
+                istep = 2*k;
+                if (istep==n)  lastKCycle = 1;
+
+                for (m=0; m<k; ++m) {
+                    a  = M_PI*(-m)/k;
+                    wr = cos (a);
+                    wi = sin (a);
+                    if (inv)  wi = -wi;     // Prepare inverse FFT
+                    ii = m;
+                    nm = (nn-m)/istep + m;
+                    for (i=m; i<=nm; ++i) {
+                        int  trz;   // Flag: tr=wr*xr[jj]-wi*xi[jj] == 0
+                        int  tiz;   // Flag: ti=wr*xi[jj]+wi*xr[jj] == 0
+
+                        jj = ii+k;
+
+                        for (b=0; genBlock(b); ++b) {
+                            genTwiddle ("tr", "ti", elem("xr",jj), 0,
+                                        elem("xi",jj), ! nzi[jj], wr, wi,
+                                        realOut && lastKCycle, &trz, &tiz);
+                            genButterfly (ii, jj, "tr", "ti", trz, tiz,
+                                          lastKCycle, realOut && lastKCycle);
                         }
-                        // Insert the new swap command at index ii, i.e.
-                        // before the command that would overwrite mr
-                        swap[i_mr].m = m;
-                        swap[i_mr].mr = mr;
-                        swap[i_mr].m_new = m_new;
-                        swap[i_mr].mr_new = mr_new;
-                        swap[i_mr].symmIn = 1;
+
+                        ii += istep;
                     }
                 }
             }
-            ++nSwap;
         }
     }
-    if (symmIn) {
-        // When optimizing assuming input symmetry then
-        //   check whether there are indices not yet considered.
-        // Therefore, check swap[] for not listed indices from n/2+1 onwards.
-        // Consider the symmetry relationship for those now.
-        // Note: This must be done before conducting the binary inversion
-        // algorithm because that will overwrite the elements with according
-        // indices.
-        for (i=n/2+1; i<n; ++i) {
-            for (ii=nSwap-1; ii>=0; --ii) {
-                if (swap[ii].m==i || swap[ii].mr==i)  break;
-            }
-            if (ii < 0) {   // i not listed in swap[]
-                printf (INDENT"xr[%d] =  xr[%d];\n", i, n - i);
-                printf (INDENT"xi[%d] = -xi[%d];\n", i, n - i);
-            }
+
+    free (nzr);
+    free (nzi);
+}
+
+
+
+//==============================================================================
+// Code generating function for a two-dimensional FFT
+//
+// Generates the code for the FFT of a complex image of rows*cols points stored
+// row by row in xr[] and xi[], i.e. point (r,c) at index r*cols+c. As the two-
+// dimensional DFT is separable it is computed by one-dimensional FFTs of all
+// rows followed by one-dimensional FFTs of all columns, both generated by
+// fftGen() with the offset and the stride of the sequence elements set
+// accordingly, see elem(). With realIn only the row FFTs and with realOut only
+// the column FFTs are optimized.
+// In row-column mode (block 0) each column is transformed completely before the
+// next one, accessing elements cols apart. Otherwise block adjacent columns are
+// transformed together, i.e. each butterfly is generated for all of them in a
+// row, see genBlock(), so that the accesses hit neighboring elements.
+//
+
+static void  genFft2d (
+    const int  rows,          // Number of rows
+    const int  cols,          // Number of columns
+    const int  inv,           // Flag: !=0: inverse FFT
+    const int  realIn,        // Flag: !=0: Optimize for real only input
+    const int  realOut,       // Flag: !=0: Optimize for real only output
+    const int  radix,         // Radix of the butterflies, 2 or 4
+    const int  split,         // Flag: !=0: Use the split-radix algorithm
+    const int  dif,           // Flag: !=0: Use decimation in frequency
+    const int  noBitRev,      // Flag: !=0: Omit the bit reversal permutation
+    const int  block          // Number of columns transformed together, 0: one
+) {
+    const GEN  saved = gen;
+    int  r, c;
+
+    // Row FFTs
+    for (r=0; r<rows; ++r) {
+        gen.offset = saved.offset + r*cols;
+        fftGen (cols, inv, realIn, 0, 0, 0, radix, split, dif, noBitRev, 0);
+    }
+
+    // Column FFTs
+    gen.stride = cols;
+    for (c=0; c<cols; c+=gen.block) {
+        gen.offset = saved.offset + c;
+        gen.block  = block > 1 ? (block < cols-c ? block : cols-c) : 1;
+        fftGen (rows, inv, 0, realOut, 0, 0, radix, split, dif, noBitRev, 0);
+    }
+
+    gen = saved;
+}
+
+
+
+//==============================================================================
+// Code generating function for a three-dimensional FFT
+//
+// Generates the code for the FFT of a complex volume of planes*rows*cols points
+// stored plane by plane, each plane row by row, i.e. point (p,r,c) at index
+// (p*rows+r)*cols+c. The two-dimensional FFT of each plane is generated by
+// genFft2d(), so the rows*cols points of one plane are transformed completely
+// while they are held in the cache. Then the one-dimensional FFTs along the
+// planes are generated, row by row, with the elements rows*cols apart. Like the
+// column FFTs of genFft2d() these are transformed in blocks of adjacent columns
+// if block is greater than one. With realIn only the row FFTs and with realOut
+// only the FFTs along the planes are optimized.
+//
+
+static void  genFft3d (
+    const int  planes,        // Number of planes
+    const int  rows,          // Number of rows of each plane
+    const int  cols,          // Number of columns of each plane
+    const int  inv,           // Flag: !=0: inverse FFT
+    const int  realIn,        // Flag: !=0: Optimize for real only input
+    const int  realOut,       // Flag: !=0: Optimize for real only output
+    const int  radix,         // Radix of the butterflies, 2 or 4
+    const int  split,         // Flag: !=0: Use the split-radix algorithm
+    const int  dif,           // Flag: !=0: Use decimation in frequency
+    const int  noBitRev,      // Flag: !=0: Omit the bit reversal permutation
+    const int  block          // Number of columns transformed together, 0: one
+) {
+    const GEN  saved = gen;
+    int  p, r, c;
+
+    // Two-dimensional FFTs of the planes
+    for (p=0; p<planes; ++p) {
+        gen.offset = saved.offset + p*rows*cols;
+        genFft2d (rows, cols, inv, realIn, 0, radix, split, dif, noBitRev, block);
+    }
+
+    // FFTs along the planes
+    gen.stride = rows*cols;
+    for (r=0; r<rows; ++r) {
+        for (c=0; c<cols; c+=gen.block) {
+            gen.offset = saved.offset + r*cols + c;
+            gen.block  = block > 1 ? (block < cols-c ? block : cols-c) : 1;
+            fftGen (planes, inv, 0, realOut, 0, 0, radix, split, dif, noBitRev, 0);
         }
     }
 
-    //--------------------------------------------------------------------------
-    // Conduct swapping
+    gen = saved;
+}
 
-    for (k=0; k<nSwap; ++k) {
-        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-        // Implement  "if (mr > m)  SWAP(x[m],x[mr]);"
-        if ( ! swap[k].symmIn) {
-            // Swapping according to standard binary inversion algorithm
-            printf (INDENT"tr = xr[%d];\n", swap[k].m);
-            printf (INDENT"xr[%d] = xr[%d];\n", swap[k].m, swap[k].mr);
-            printf (INDENT"xr[%d] = tr;\n", swap[k].mr);
-            if ( ! realIn) {
-                printf (INDENT"ti = xi[%d];\n", swap[k].m);
-                printf (INDENT"xi[%d] = xi[%d];\n", swap[k].m, swap[k].mr);
-                printf (INDENT"xi[%d] = ti;\n", swap[k].mr);
-            }
-        } else {
-            // Use the conjugate complex value of (xr[n-mr],xi[n-mr]) but only
-            // if the source index of the assignment would have been >n/2
-            printf (INDENT"xr[%d] = xr[%d];\n", swap[k].mr, swap[k].m_new);
-            printf (INDENT"xr[%d] = xr[%d];\n", swap[k].m, swap[k].mr_new);
-            if ( ! realIn) {
-                if (swap[k].m <= n/2) {
-                    printf (INDENT"xi[%d] = xi[%d];\n", swap[k].mr, swap[k].m_new);
-                } else {
-                    // Negating xi for the conjugate complex value is required
-                    printf (INDENT"xi[%d] = -xi[%d];\n", swap[k].mr, swap[k].m_new);
-                }
-                if (swap[k].mr <= n/2) {
-                    printf (INDENT"xi[%d] = xi[%d];\n", swap[k].m, swap[k].mr_new);
-                } else {
-                    // Negating xi for the conjugate complex value is required
-                    printf (INDENT"xi[%d] = -xi[%d];\n", swap[k].m, swap[k].mr_new);
-                }
-            }
+
+
+//==============================================================================
+// Code generating function for a batch of FFTs
+//
+// Generates the code for the FFTs of batch signals stored interleaved in xr[]
+// and xi[], i.e. element i of signal b at index i*batch+b. Every butterfly,
+// every swap, and every cycle of a permutation is generated for all signals one
+// after the other, see genBlock(). So the code consists of groups of batch
+// identical statements or butterflies on adjacent elements, which the compiler
+// can merge into SIMD instructions without any shuffles.
+//
+
+static void  genBatch (
+    const int  n,             // Number of points
+    const int  batch,         // Number of signals
+    const int  inv,           // Flag: !=0: inverse FFT
+    const int  realIn,        // Flag: !=0: Optimize for real only input
+    const int  realOut,       // Flag: !=0: Optimize for real only output
+    const int  symmIn,        // Flag: !=0: Optimize for symmetry at input
+    const int  symmOut,       // Flag: !=0: Optimize for symmetry at output
+    const int  radix,         // Radix of the butterflies, 2 or 4
+    const int  split,         // Flag: !=0: Use the split-radix algorithm
+    const int  dif,           // Flag: !=0: Use decimation in frequency
+    const int  noBitRev       // Flag: !=0: Omit the bit reversal permutation
+) {
+    const GEN  saved = gen;
+
+    gen.stride = batch;
+    gen.block  = batch;
+    fftGen (n, inv, realIn, realOut, symmIn, symmOut, radix, split, dif,
+            noBitRev, 0);
+
+    gen = saved;
+}
+
+
+
+//==============================================================================
+// Code generating function for an FFT of unrolled codelets and loops
+//
+// Generates the code for an FFT of a large number of points n with a bounded
+// code size. The bit reversal permutation is done by a loop. Then the first
+// stages, which transform the blocks of codelet adjacent elements independently
+// of each other, are done by a loop over the blocks applying the unrolled FFT of
+// codelet points generated by fftGen() without bit reversal. The indices of its
+// elements are relative to the loop variable i, see elem(). The remaining stages
+// are done in passes, each combining m transforms of h points to transforms of
+// m*h points, m being the number of points of the codelet or less for the last
+// pass. For each offset j<h the twiddle factors exp(-+2*pi*i*j*s/(m*h)),
+// s=1...m-1, are computed once. The angle 2*pi*t/n, t=j*s*n/(m*h), is split
+// into t=a*f+b with f being about sqrt(n), so the factor is the product of
+// exp(2*pi*i*a*f/n) from the table wc[] and exp(2*pi*i*b/n) from the table wf[],
+// each holding the cosine and sine values of about sqrt(n) angles. Then a loop
+// over the blocks of m*h elements multiplies the elements j+r*h, r=1...m-1, of
+// each block by the twiddle factors for s being the bit reversed r and applies
+// the unrolled FFT of m points to them, generated with the stride h, see
+// genHybridTwiddle(). The code is enclosed in a block, which defines the tables
+// of the given type, the twiddle factors, and the loop variables.
+//
+
+static void  genHybrid (
+    const int    n,           // Number of points
+    const int    codelet,     // Number of points of the codelets
+    const int    inv,         // Flag: !=0: inverse FFT
+    const int    radix,       // Radix of the butterflies of the codelets
+    const int    split,       // Flag: !=0: Use the split-radix algorithm
+    const char  *type         // Type of the table elements
+) {
+    const GEN  saved = gen;
+    const int  m0 = n/codelet < codelet ? n/codelet : codelet;
+    int  fine, k, l, m, h, r;
+
+    // Number of angles of the fine table, about sqrt(n)
+    for (fine=1; fine*fine < n; fine*=2)  ;
+
+    // The values are computed from the first eighth of the period and rotated
+    // to the quadrant, so they are exactly symmetric and cos(pi/2) is exactly
+    // zero, adding 0. to avoid -0.
+    genOut (INDENT"{\n");
+    for (l=0; l<2; ++l) {
+        const int  size = l ? fine : n/fine;    // Number of angles
+        const int  step = l ? 1 : fine;         // Angles are 2*pi*k*step/n
+        genOut (INDENT"    static const %s  %s[%d] = {", type, l ? "wf" : "wc",
+                2*size);
+        for (k=0; k<2*size; ++k) {
+            const int     q = k/2*step / (n/4);     // Quadrant
+            const int     r = k/2*step % (n/4);     // Angle in the quadrant
+            const double  c = r <= n/8 ? cos (2.*M_PI*r/n) : sin (2.*M_PI*(n/4-r)/n);
+            const double  v = r <= n/8 ? sin (2.*M_PI*r/n) : cos (2.*M_PI*(n/4-r)/n);
+            static const int  sc[4][2] = {{1,0}, {0,-1}, {-1,0}, {0,1}};
+            if (k%3 == 0)  genOut ("\n"INDENT"       ");
+            genOut (" "NUMBER_FORMAT"%s", k%2 ? sc[q][0]*v - sc[q][1]*c + 0.
+                                              : sc[q][0]*c + sc[q][1]*v + 0.,
+                    k < 2*size-1 ? "," : "");
+        }
+        genOut ("\n"INDENT"    };\n");
+    }
+    genOut (INDENT"    %s  cw[%d], sw[%d]", type, m0, m0);
+    if (gen.cmul == CMUL_THREE)  genOut (", pw[%d], mw[%d]", m0, m0);
+    genOut (";\n");
+    genOut (INDENT"    int  i, j, k, s, t;\n");
+
+    // Bit reversal permutation
+    genOut ("\n");
+    genOut (INDENT"    for (i=0, j=0; i<%d; ++i) {\n", n);
+    genOut (INDENT"        if (i < j) {\n");
+    genOut (INDENT"            tr = xr[i];\n");
+    genOut (INDENT"            xr[i] = xr[j];\n");
+    genOut (INDENT"            xr[j] = tr;\n");
+    genOut (INDENT"            ti = xi[i];\n");
+    genOut (INDENT"            xi[i] = xi[j];\n");
+    genOut (INDENT"            xi[j] = ti;\n");
+    genOut (INDENT"        }\n");
+    genOut (INDENT"        for (k=%d; k > 0  &&  j >= k; k/=2)  j -= k;\n", n/2);
+    genOut (INDENT"        j += k;\n");
+    genOut (INDENT"    }\n");
+
+    // Unrolled codelets, written to a temporary file to indent them
+    genOut ("\n");
+    genOut (INDENT"    for (i=0; i<%d; i+=%d) {\n", n, codelet);
+    gen.out = tmpfile ();
+    if (gen.out == NULL) {
+        fprintf (stderr, "\n"LOGO": Error creating temporary file: %s\n",
+                 strerror(errno));
+        exit (EXIT_FAILURE);
+    }
+    gen.base = "i";
+    fftGen (codelet, inv, 0, 0, 0, 0, radix, split, 0, 1, 0);
+    genCopy (saved.out, "        ");
+    genOut (INDENT"    }\n");
+
+    // Remaining stages by passes of codelets on elements h apart
+    for (h=codelet; h<n; h*=m) {
+        m = n/h < codelet ? n/h : codelet;
+        genOut ("\n");
+        genOut (INDENT"    for (j=0; j<%d; ++j) {\n", h);
+        genOut (INDENT"        for (s=1; s<%d; ++s) {\n", m);
+        if (n/(m*h) > 1)  genOut (INDENT"            t = j*s*%d;\n", n/(m*h));
+        else              genOut (INDENT"            t = j*s;\n");
+        genOut (INDENT"            k = t/%d*2;\n", fine);
+        genOut (INDENT"            t = t%%%d*2;\n", fine);
+        genOut (INDENT"            cw[s] = wc[k]*wf[t] - wc[k+1]*wf[t+1];\n");
+        genOut (INDENT"            sw[s] = %swc[k+1]*wf[t] %c wc[k]*wf[t+1];\n",
+                inv ? "" : "-", inv ? '+' : '-');
+        if (gen.cmul == CMUL_THREE) {
+            genOut (INDENT"            pw[s] = cw[s] + sw[s];\n");
+            genOut (INDENT"            mw[s] = sw[s] - cw[s];\n");
+        }
+        genOut (INDENT"        }\n");
+        genOut (INDENT"        for (i=j; i<%d; i+=%d) {\n", n, m*h);
+        gen.out = tmpfile ();
+        if (gen.out == NULL) {
+            fprintf (stderr, "\n"LOGO": Error creating temporary file: %s\n",
+                     strerror(errno));
+            exit (EXIT_FAILURE);
+        }
+        gen.base = "i";
+        gen.stride = h;
+        for (r=1; r<m; ++r) {
+            genHybridTwiddle (r, bitRev (r, m));
         }
+        fftGen (m, inv, 0, 0, 0, 0, radix, split, 0, 1, 0);
+        genCopy (saved.out, "            ");
+        gen.stride = saved.stride;
+        genOut (INDENT"        }\n");
+        genOut (INDENT"    }\n");
     }
-    putchar ('\n');
+    genOut (INDENT"}\n");
 
-    //==========================================================================
-    // Do the transform
-
-    for (k=1; k<n; k=istep) {
-        istep = 2*k;
-        if (istep==n)  lastKCycle = 1;
-
-        for (m=0; m<k; ++m) {
-            a  = M_PI*(-m)/k;
-            wr = cos (a);
-            wi = sin (a);
-            if (inv)  wi = -wi;     // Prepare inverse FFT
-            ii = m;
-            nm = (nn-m)/istep + m;
-            for (i=m; i<=nm; ++i) {
-                size_t  len;
-                               // Flag: 1st summand of
-                               //   tr = wr*xr[jj] - wi*xi[jj];
-                               // or
-                               //   ti = wr*xi[jj] + wi*xr[jj];
-                               // is zero
-                int  firstOpZero;
-                int  trz = 0;  // Flag: Expression tr=wr*xr[jj]-wi*xi[jj] == 0
-                int  tiz = 0;  // Flag: Expression ti=wr*xi[jj]+wi*xr[jj] == 0
-
-                jj = ii+k;
+    gen = saved;
+}
 
-#ifndef OPTIMIZE_SINE_COSINE_VALUES
-                printf (INDENT"tr = "NUMBER_FORMAT"*xr[%d] - "NUMBER_FORMAT"*xi[%d];\n", wr, jj, wi, jj);
-                printf (INDENT"ti = "NUMBER_FORMAT"*xi[%d] + "NUMBER_FORMAT"*xr[%d];\n", wr, jj, wi, jj);
-#else
-                //--------------------------------------------------------------
-                // Implement tr = wr*xr[jj] - wi*xi[jj];
 
-                //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-                // Part wr*xr[jj]
-                firstOpZero = 0;
-
-                snprintf (line, LINELEN, INDENT"tr =");
-                len = strlen (line);
-
-                if (fabs(wr) > eps) {
-                    // wr != 0
-                    if (wr < epsOne) {
-                        // wr != 1
-                        if (wr > epsMOne) {
-                            // wr != -1
-                            snprintf (line+len,LINELEN-len," "NUMBER_FORMAT"*xr[%d]", wr, jj);
-                        } else {
-                            // wr == -1
-                            snprintf (line+len,LINELEN-len," -xr[%d]", jj);
-                        }
-                    } else {
-                        // wr == 1
-                        snprintf (line+len,LINELEN-len," xr[%d]", jj);
-                    }
-                } else {
-                    firstOpZero = 1;
-                }
-                len = strlen (line);
 
-                //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-                // Part -wi*xi[jj]
-
-                trz = 0;
-                if (fabs(wi) > eps  &&  nzi[jj]) {
-                    // wi != 0  and  xi[jj] non-zero
-                    if (wi < epsOne) {
-                        // wi != 1
-                        if (wi > epsMOne) {
-                            // wi != -1
-                            if ( ! firstOpZero) {       // If wr*xr[jj] != 0
-                                if (wi >= 0.0) {
-                                    snprintf (line+len,LINELEN-len," - "NUMBER_FORMAT"*xi[%d]", wi, jj);
-                                } else {
-                                    snprintf (line+len,LINELEN-len," + "NUMBER_FORMAT"*xi[%d]", -wi, jj);
-                                }
-                            } else {
-                                snprintf (line+len,LINELEN-len," "NUMBER_FORMAT"*xi[%d]", -wi, jj);
-                            }
-                        } else {
-                            // wi == -1
-                            if ( ! firstOpZero) {
-                                snprintf (line+len,LINELEN-len," + xi[%d]", jj);
-                            } else {
-                                snprintf (line+len,LINELEN-len," xi[%d]", jj);
-                            }
-                        }
-                    } else {
-                        // wi == 1
-                        snprintf (line+len,LINELEN-len," - xi[%d]", jj);
-                    }
-                    fputs (line, stdout);
-                    fputs (";\n", stdout);
-                } else {
-                    // wr == 0  or  xi[jj] == 0
-                    if ( ! firstOpZero) {
-                        fputs (line, stdout);
-                        fputs (";\n", stdout);
-                    } else {
-                        trz = 1;    // tr = wr*xr[jj]-wi*xi[jj] == 0
-                        // Expression for tr is zero, so don't write anything
-                    }
-                }
+//==============================================================================
+// Code generating function for a multiplication by a twiddle factor in a loop
+//
+// Generates the code multiplying the sequence element r by the twiddle factor
+// cw[s]+i*sw[s] computed at run time by the code of genHybrid(). Option -u
+// selects the form like for the constant twiddle factors, see genTwiddle(),
+// with the sums pw[s]=cw[s]+sw[s] and mw[s]=sw[s]-cw[s] of the 3mul form
+// computed together with the twiddle factors. The ratio form needs a branch on
+// the greater part, so the plain form is written instead, which the compiler
+// contracts to the same one multiplication and one FMA per part.
+//
 
-                //--------------------------------------------------------------
-                // Implement ti = wr*xi[jj] + wi*xr[jj];
-
-                if ( ! (realOut && lastKCycle)) {
-
-                    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-                    // Part wr*xi[jj]
-
-                    firstOpZero = 0;
-                    snprintf (line, LINELEN, INDENT"ti =");
-                    len = strlen (line);
-
-                    if (fabs(wr) > eps  &&  nzi[jj]) {
-                        // wr != 0  and  xi[jj] non-zero
-                        if (wr < epsOne) {
-                            // wr != 1
-                            if (wr > epsMOne) {
-                                // wr != -1
-                                snprintf (line+len,LINELEN-len," "NUMBER_FORMAT"*xi[%d]", wr, jj);
-                            } else {
-                                // wr == -1
-                                snprintf (line+len,LINELEN-len," -xi[%d]", jj);
-                            }
-                        } else {
-                            // wr == 1
-                            snprintf (line+len,LINELEN-len," xi[%d]", jj);
-                        }
-                    } else {
-                        firstOpZero = 1;
-                    }
-                    len = strlen (line);
-
-                    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-                    // Part +wi*xr[jj]
-
-                    tiz = 0;
-                    if (fabs(wi) > eps) {
-                        // wi != 0
-                        if (wi < epsOne) {
-                            // wi != 1
-                            if (wi > epsMOne) {
-                                // wi != -1
-                                if ( ! firstOpZero) {       // If wr*xr[jj] != 0
-                                    if (wi >= 0.0) {
-                                        snprintf (line+len,LINELEN-len," + "NUMBER_FORMAT"*xr[%d]", wi, jj);
-                                    } else {
-                                        snprintf (line+len,LINELEN-len," - "NUMBER_FORMAT"*xr[%d]", -wi, jj);
-                                    }
-                                } else {
-                                    snprintf (line+len,LINELEN-len," "NUMBER_FORMAT"*xr[%d]", wi, jj);
-                                }
-                            } else {
-                                // wi == -1
-                                snprintf (line+len,LINELEN-len," - xr[%d]", jj);
-                            }
-                        } else {
-                            // wi == 1
-                            snprintf (line+len,LINELEN-len," xr[%d]", jj);
-                        }
-                        fputs (line, stdout);
-                        fputs (";\n", stdout);
-                    } else {
-                        // wi == 0
-                        if ( ! firstOpZero) {      // If wr*xi[jj] != 0
-                            fputs (line, stdout);
-                            fputs (";\n", stdout);
-                        } else {
-                            tiz = 1;    // ti = wr*xi[jj]+wi*xr[jj] == 0
-                            // Expression for tr is zero, so don't write anything
-                        }
-                    }
-                }
-#endif
-                if ( ! (symmOut && lastKCycle && jj!=n/2)) {
-                    //----------------------------------------------------------
-                    // Implement xr[jj] = xr[ii] - tr;
+static void  genHybridTwiddle (
+    const int  r,             // Index of the sequence element
+    const int  s              // Index of the twiddle factor
+) {
+    char  xr[32], xi[32];
+
+    snprintf (xr, sizeof(xr), "%s", elem ("xr", r));
+    snprintf (xi, sizeof(xi), "%s", elem ("xi", r));
+    if (gen.cmul == CMUL_FMA) {
+        genOut (INDENT"tr = %s (cw[%d], %s, -sw[%d]*%s);\n",
+                gen.fma, s, xr, s, xi);
+        genOut (INDENT"%s = %s (cw[%d], %s, sw[%d]*%s);\n",
+                xi, gen.fma, s, xi, s, xr);
+    } else if (gen.cmul == CMUL_THREE) {
+        genOut (INDENT"tk = cw[%d]*(%s + %s);\n", s, xr, xi);
+        genOut (INDENT"tr = tk - pw[%d]*%s;\n", s, xi);
+        genOut (INDENT"%s = tk + mw[%d]*%s;\n", xi, s, xr);
+    } else {
+        genOut (INDENT"tr = cw[%d]*%s - sw[%d]*%s;\n", s, xr, s, xi);
+        genOut (INDENT"%s = cw[%d]*%s + sw[%d]*%s;\n", xi, s, xi, s, xr);
+    }
+    genOut (INDENT"%s = tr;\n", xr);
+}
 
-                    if ( ! trz) {
-                        printf (INDENT"xr[%d] = xr[%d] - tr;\n", jj, ii);
-                    } else {
-                        printf (INDENT"xr[%d] = xr[%d];\n", jj, ii);
-                    }
 
-                    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-                    // Implement xi[jj] = xi[ii] - ti;
-
-                    if ( ! (realOut && lastKCycle)) {
-                        if ( ! tiz) {
-                            if (nzi[ii]) {
-                                printf (INDENT"xi[%d] = xi[%d] - ti;\n", jj, ii);
-                            } else {
-                                printf (INDENT"xi[%d] = - ti;\n", jj);
-                            }
-                            nzi[jj] = 1;
-                        } else {
-                            if (nzi[ii]) {
-                                printf (INDENT"xi[%d] = xi[%d];\n", jj, ii);
-                                nzi[jj] = 1;
-                            } else if (realIn && lastKCycle) {
-                                // In case of realIn this element has not yet
-                                // been touched. So it must be set zero here
-                                // because imaginary input values at realIn
-                                // could be arbitrary but should contain valid
-                                // values at output
-                                printf (INDENT"xi[%d] = 0.0;\n", jj);
-                            }
-                        }
-                    }
-                }
 
-                //--------------------------------------------------------------
-                // Implement xr[ii] += tr;
+//==============================================================================
+// Code generating function for a real FFT
+//
+// Generates the code for the FFT of n real values stored in one array x[]. The
+// values are regarded as a sequence z of n/2 complex values with z[k]=x[2k]+
+// i*x[2k+1], which is transformed by the code generated by fftGen() working on
+// that view of x[], see elem(). The result Z is then split into the transforms
+// of the even and odd elements of x and these are combined to the first half
+// X[0]...X[n/2] of the transform of x, see genRealPost(). It is stored in the
+// packed format
+//   x[0] = Re X[0],  x[1] = Re X[n/2],  x[2k] = Re X[k],  x[2k+1] = Im X[k]
+// for k=1...n/2-1. The elements X[n/2+1]...X[n-1] are given by the symmetry
+// relationship X[k]=X*[n-k].
+// The inverse FFT takes X[0]...X[n/2] in that packed format, reverses the
+// combination, see genRealPre(), and computes the inverse complex transform of
+// length n/2. So it writes n real values to x[], like the inverse complex FFT
+// scaled by n.
+//
 
-                if ( ! trz) {
-                    printf (INDENT"xr[%d] += tr;\n", ii);
-                }
+static void  genRealFft (
+    const int  n,             // Number of points
+    const int  inv,           // Flag: !=0: inverse FFT
+    const int  radix,         // Radix of the butterflies, 2 or 4
+    const int  split,         // Flag: !=0: Use the split-radix algorithm
+    const int  dif            // Flag: !=0: Use decimation in frequency
+) {
+    if (n < 2)  return;         // Nothing to do
 
-                //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
-                // Implement xi[ii] += ti;
+    gen.realView = 1;
 
-                if ( ! (realOut && lastKCycle)) {
-                    if ( ! tiz) {
-                        if (nzi[ii]) {
-                            printf (INDENT"xi[%d] += ti;\n", ii);
-                        } else {
-                            printf (INDENT"xi[%d] = ti;\n", ii);
-                            nzi[ii] = 1;
-                        }
-                    } else if (realIn && lastKCycle) {
-                        // In case of realIn this element has not yet been
-                        // touched. So it must be set zero here because
-                        // imaginary input values at realIn could be arbitrary
-                        // but should contain valid values at output
-                        printf (INDENT"xi[%d] = 0.0;\n", ii);
-                    }
-                }
+    if ( ! inv) {
+        fftGen (n/2, inv, 0, 0, 0, 0, radix, split, dif, 0, 0);
+        genRealPost (n);
+    } else {
+        genRealPre (n);
+        fftGen (n/2, inv, 0, 0, 0, 0, radix, split, dif, 0, 0);
+    }
 
-                ii += istep;
-            }
-        }
+    gen.realView = 0;
+}
+
+
+
+//==============================================================================
+// Generate code for the pre-processing stage of an inverse real FFT
+//
+// Reverses the combination of genRealPost(). With h=n/2, the input spectrum X
+// of the real sequence, and W=exp(-2*pi*i/n) the input Z of the inverse complex
+// transform of length h is computed by
+//   E[k] = X[k] + X*[h-k]
+//   O[k] = W^-k * (X[k] - X*[h-k])
+//   Z[k] = E[k] + i*O[k],    Z[h-k] = E*[k] + i*O*[k]
+// for 0<k<h/2, and Z[0]=X[0]+X[h] + i*(X[0]-X[h]), Z[h/2]=2*X*[h/2]. This is
+// twice the inverse of the post-processing stage, so the result of the inverse
+// real FFT is scaled by n like that of the inverse complex FFT.
+//
+
+static void  genRealPre (
+    const int  n              // Number of points of the real FFT
+) {
+    const int  h = n/2;
+    const double  a = h%2 ? M_PI/(2*n) : 2.*M_PI/n;     // See fftGen()
+    int  k, trz, tiz;
+
+    gen.eps     = 0.5*sin(a);
+    gen.epsOne  =  1.0 - 0.5*(1.0-cos(a));
+    gen.epsMOne = -1.0 + 0.5*(1.0-cos(a));
+
+    // Z[0]
+    genOut (INDENT"tr = %s;\n", elem("xr",0));
+    genOut (INDENT"%s = tr + %s;\n", elem("xr",0), elem("xi",0));
+    genOut (INDENT"%s = tr - %s;\n", elem("xi",0), elem("xi",0));
+
+    for (k=1; 2*k<h; ++k) {
+        const double  a = 2.*M_PI*k/n;
+
+        // E[k] and X[k] - X*[h-k]
+        genOut (INDENT"ur = %s + %s;\n", elem("xr",k), elem("xr",h-k));
+        genOut (INDENT"ui = %s - %s;\n", elem("xi",k), elem("xi",h-k));
+        genOut (INDENT"vr = %s - %s;\n", elem("xr",k), elem("xr",h-k));
+        genOut (INDENT"vi = %s + %s;\n", elem("xi",k), elem("xi",h-k));
+
+        // O[k]
+        genTwiddle ("tr", "ti", "vr", 0, "vi", 0, cos(a), sin(a), 0,
+                    &trz, &tiz);
+
+        // Z[k] and Z[h-k]
+        genOut (INDENT"%s = ur - ti;\n", elem("xr",k));
+        genOut (INDENT"%s = ui + tr;\n", elem("xi",k));
+        genOut (INDENT"%s = ur + ti;\n", elem("xr",h-k));
+        genOut (INDENT"%s = tr - ui;\n", elem("xi",h-k));
     }
 
-    free (swap);
-    free (nzi);
+    // Z[h/2]
+    if (h%2 == 0) {
+        genOut (INDENT"%s =  2.0*%s;\n", elem("xr",h/2), elem("xr",h/2));
+        genOut (INDENT"%s = -2.0*%s;\n", elem("xi",h/2), elem("xi",h/2));
+    }
+
+    genOut ("\n");
+}
+
+
+
+//==============================================================================
+// Generate code for the post-processing stage of a real FFT
+//
+// With h=n/2, the result Z of the complex transform of length h, and
+// W=exp(-2*pi*i/n) the transform X of the real sequence is computed by
+//   E[k] = (Z[k] + Z*[h-k]) / 2
+//   O[k] = -i * (Z[k] - Z*[h-k]) / 2
+//   X[k] = E[k] + W^k*O[k],    X[h-k] = (E[k] - W^k*O[k])*
+// for 0<k<h/2, and X[0]=Re Z[0]+Im Z[0], X[h]=Re Z[0]-Im Z[0], and, if h is
+// even, X[h/2]=Z*[h/2]. The factor 1/2 of O[k] is contained in the twiddle
+// factor.
+//
+
+static void  genRealPost (
+    const int  n              // Number of points of the real FFT
+) {
+    const int  h = n/2;
+    const double  a = h%2 ? M_PI/(2*n) : 2.*M_PI/n;     // See fftGen()
+    int  k, trz, tiz;
+
+    // The twiddle factors are scaled by 1/2, so the limit for detecting zero
+    // values must be scaled as well
+    gen.eps     = 0.25*sin(a);
+    gen.epsOne  =  1.0 - 0.5*(1.0-cos(a));
+    gen.epsMOne = -1.0 + 0.5*(1.0-cos(a));
+
+    genOut ("\n");
+
+    // X[0] and X[h]
+    genOut (INDENT"tr = %s;\n", elem("xr",0));
+    genOut (INDENT"%s = tr + %s;\n", elem("xr",0), elem("xi",0));
+    genOut (INDENT"%s = tr - %s;\n", elem("xi",0), elem("xi",0));
+
+    for (k=1; 2*k<h; ++k) {
+        const double  a = 2.*M_PI*(-k)/n;
+
+        // E[k] and 2*O[k]
+        genOut (INDENT"ur = 0.5*(%s + %s);\n", elem("xr",k), elem("xr",h-k));
+        genOut (INDENT"ui = 0.5*(%s - %s);\n", elem("xi",k), elem("xi",h-k));
+        genOut (INDENT"vr = %s + %s;\n", elem("xi",k), elem("xi",h-k));
+        genOut (INDENT"vi = %s - %s;\n", elem("xr",h-k), elem("xr",k));
+
+        // W^k*O[k]
+        genTwiddle ("tr", "ti", "vr", 0, "vi", 0, 0.5*cos(a), 0.5*sin(a), 0,
+                    &trz, &tiz);
+
+        // X[k] and X[h-k]
+        genOut (INDENT"%s = ur + tr;\n", elem("xr",k));
+        genOut (INDENT"%s = ui + ti;\n", elem("xi",k));
+        genOut (INDENT"%s = ur - tr;\n", elem("xr",h-k));
+        genOut (INDENT"%s = ti - ui;\n", elem("xi",h-k));
+    }
+
+    // X[h/2]
+    if (h%2 == 0)  genOut (INDENT"%s = -%s;\n", elem("xi",h/2), elem("xi",h/2));
+}
+
+
+
+//==============================================================================
+// Code generating function for a DCT-II or DCT-III
+//
+// Generates the code for the DCT-II of n real values stored in one array x[]
+//   X[k] = sum_j(x[j] * cos(pi*(2j+1)*k/(2n)))
+// for k=0...n-1, or for the inverse DCT-III
+//   x[j] = X[0]/2 + sum_k(X[k] * cos(pi*(2j+1)*k/(2n)))
+// summing over k=1...n-1, so the DCT-III of the DCT-II yields the input
+// scaled by n/2. The DCT-II is computed by the real FFT of length n of the
+// sequence v[j]=x[2j], v[n-1-j]=x[2j+1], j=0...n/2-1, with X[k]=Re(R^k*V[k])
+// and X[n-k]=-Im(R^k*V[k]), R=exp(-i*pi/(2n)) (Makhoul). The real FFT is
+// computed as described for genRealFft(), but the multiplication by R^k is
+// folded into the constants of its post-processing stage, see genDctPost().
+// The move of x[] to v[] is folded into the bit or digit reversal of the
+// complex transform of length n/2, which is generated for input in that order.
+// So the code consists of a permutation, the complex transform, a combined
+// post-processing stage, and a permutation of the results to their natural
+// order. The DCT-III reverses these steps, see genDctPre().
+//
+
+static void  genDct (
+    const int  n,             // Number of points
+    const int  inv,           // Flag: !=0: DCT-III, otherwise DCT-II
+    const int  radix,         // Radix of the butterflies, 2 or 4
+    const int  split          // Flag: !=0: Use the split-radix algorithm
+) {
+    const int  h = n/2;
+    int  *pos;                  // pos[k]: Index of element k at the input of
+                                //   the transform of length h
+    int  *src;                  // Source indices of the permutations
+    int  j, k;
+
+    if (n < 2)  return;         // Nothing to do
+
+    pos = (int*)malloc (sizeof(int)*h);
+    src = (int*)malloc (sizeof(int)*n);
+    if (pos == NULL  ||  src == NULL) {
+        fprintf (stderr, "\n"LOGO": Error allocating memory: %s\n", strerror(errno));
+        exit (EXIT_FAILURE);
+    }
+
+    inputOrder (h, pos);
+
+    gen.realView = 1;
+
+    if ( ! inv) {
+        // x[] to v[], v[] to z[] in input order of the complex transform
+        for (k=0; k<h; ++k) {
+            src[2*pos[k]]   = 2*k   < h ? 4*k   : 2*(n-1-2*k)+1;
+            src[2*pos[k]+1] = 2*k+1 < h ? 4*k+2 : 2*(n-2-2*k)+1;
+        }
+        genRealPermutation (n, src);
+        fftGen (h, 0, 0, 0, 0, 0, radix, split, 0, 1, 0);
+        genDctPost (n);
+
+        // X[k] to its natural order
+        src[0] = 0;
+        src[h] = 1;
+        for (k=1; k<h; ++k) {
+            src[k]   = 2*k;
+            src[n-k] = 2*k+1;
+        }
+        genRealPermutation (n, src);
+    } else {
+        // X[k] and X[n-k] to the real and imaginary part of element pos[k]
+        src[2*pos[0]]   = 0;
+        src[2*pos[0]+1] = h;
+        for (k=1; k<h; ++k) {
+            src[2*pos[k]]   = k;
+            src[2*pos[k]+1] = n-k;
+        }
+        genRealPermutation (n, src);
+        genDctPre (n, pos);
+        fftGen (h, 1, 0, 0, 0, 0, radix, split, 0, 1, 0);
+
+        // v[] to x[]
+        for (j=0; j<h; ++j) {
+            src[2*j]   = j;
+            src[2*j+1] = n-1-j;
+        }
+        genRealPermutation (n, src);
+    }
+
+    gen.realView = 0;
+
+    free (pos);
+    free (src);
+}
+
+
+
+//==============================================================================
+// Generate code for the post-processing stage of a DCT-II
+//
+// Combines the post-processing stage of the real FFT, see genRealPost(), with
+// the multiplication by R^k, R=exp(-i*pi/(2n)). With h=n/2 and the result Z of
+// the complex transform of length h the DCT-II is computed by
+//   E[k] = Z[k] + Z*[h-k],         O[k] = -i * (Z[k] - Z*[h-k])
+//   P[k] = E[k] + W^k*O[k],        Q[k] = E[k] - W^k*O[k]
+//   X[k] - i*X[n-k]   = R^k/2 * P[k]
+//   X[h-k] + i*X[h+k] = exp(i*pi/4)*R^k/2 * Q[k]
+// for 0<k<h/2, W=exp(-2*pi*i/n), and X[0]=Re Z[0]+Im Z[0], X[h]=(Re Z[0]-
+// Im Z[0])/sqrt(2), and, if h is even, X[h/2]+i*X[n-h/2]=R^-(h/2)*Z[h/2].
+// All factors 1/2 and 1/sqrt(2) are contained in the constants, so it takes
+// 12 real multiplications for 4 values. The values X[k] and X[n-k] are stored
+// in the real and imaginary part of element k, X[h] in the imaginary part of
+// element 0.
+//
+
+static void  genDctPost (
+    const int  n              // Number of points of the DCT
+) {
+    const int  h = n/2;
+    int  k, trz, tiz;
+
+    // None of the constants is zero or one
+    gen.eps     = 1e-12;
+    gen.epsOne  =  1.0 - 1e-12;
+    gen.epsMOne = -1.0 + 1e-12;
+
+    genOut ("\n");
+
+    // X[0] and X[h]
+    genOut (INDENT"tr = %s;\n", elem("xr",0));
+    genOut (INDENT"%s = tr + %s;\n", elem("xr",0), elem("xi",0));
+    genOut (INDENT"%s = %s*(tr - %s);\n", elem("xi",0), constant(sqrt(0.5)),
+            elem("xi",0));
+
+    for (k=1; 2*k<h; ++k) {
+        const double  a = 2.*M_PI*(-k)/n;
+        const double  r = M_PI*(-k)/(2*n);
+
+        // E*[k] and O*[k]
+        genOut (INDENT"ur = %s + %s;\n", elem("xr",k), elem("xr",h-k));
+        genOut (INDENT"ui = %s - %s;\n", elem("xi",h-k), elem("xi",k));
+        genOut (INDENT"vr = %s + %s;\n", elem("xi",k), elem("xi",h-k));
+        genOut (INDENT"vi = %s - %s;\n", elem("xr",k), elem("xr",h-k));
+
+        // (W^k*O[k])*
+        genTwiddle ("tr", "ti", "vr", 0, "vi", 0, cos(a), -sin(a), 0,
+                    &trz, &tiz);
+
+        // Q[k] and P*[k]
+        genOut (INDENT"vr = ur - tr;\n");
+        genOut (INDENT"vi = ti - ui;\n");
+        genOut (INDENT"ur += tr;\n");
+        genOut (INDENT"ui += ti;\n");
+
+        // X[k], X[n-k], X[h-k], and X[h+k]
+        genTwiddle (elem("xr",k), elem("xi",k), "ur", 0, "ui", 0,
+                    0.5*cos(r), -0.5*sin(r), 0, &trz, &tiz);
+        genTwiddle (elem("xr",h-k), elem("xi",h-k), "vr", 0, "vi", 0,
+                    0.5*cos(r+M_PI/4), 0.5*sin(r+M_PI/4), 0, &trz, &tiz);
+    }
+
+    // X[h/2] and X[n-h/2]
+    if (h%2 == 0) {
+        const double  r = M_PI*h/(4*n);
+        genOut (INDENT"tr = %s;\n", elem("xr",h/2));
+        genTwiddle (elem("xr",h/2), elem("xi",h/2), "tr", 0, elem("xi",h/2), 0,
+                    cos(r), sin(r), 0, &trz, &tiz);
+    }
+
+    genOut ("\n");
+}
+
+
+
+//==============================================================================
+// Generate code for the pre-processing stage of a DCT-III
+//
+// Reverses the combination of genDctPost() and combines it with the
+// pre-processing stage of the inverse real FFT, see genRealPre(). With h=n/2
+// and W=exp(-2*pi*i/n) the input Z of the inverse complex transform of length
+// h is computed by
+//   P[k] = R^-k/2 * (X[k] - i*X[n-k])
+//   Q[k] = exp(-i*pi/4)*R^-k/2 * (X[h-k] + i*X[h+k])
+//   E[k] = P[k] + Q[k],            O[k] = W^-k * (P[k] - Q[k])
+//   Z[k] = E[k] + i*O[k],          Z[h-k] = E*[k] + i*O*[k]
+// for 0<k<h/2, and Z[0]=X[0]/2+X[h]/sqrt(2) + i*(X[0]/2-X[h]/sqrt(2)), and, if
+// h is even, Z[h/2]=R^(h/2)*(X[h/2]+i*X[n-h/2]). X[k] and X[n-k] are expected
+// in the real and imaginary part of element pos[k], X[h] in the imaginary part
+// of element pos[0], and Z[k] is stored there. P[k] and Q[k] are half of the
+// spectrum of v[], see genDct(), so the inverse complex transform yields the
+// DCT-III.
+//
+
+static void  genDctPre (
+    const int   n,            // Number of points of the DCT
+    const int  *pos           // pos[k]: Index of element k
+) {
+    const int  h = n/2;
+    int  k, trz, tiz;
+
+    // None of the constants is zero or one
+    gen.eps     = 1e-12;
+    gen.epsOne  =  1.0 - 1e-12;
+    gen.epsMOne = -1.0 + 1e-12;
+
+    // Z[0]
+    genOut (INDENT"tr = 0.5*%s;\n", elem("xr",pos[0]));
+    genOut (INDENT"ti = %s*%s;\n", constant(sqrt(0.5)), elem("xi",pos[0]));
+    genOut (INDENT"%s = tr + ti;\n", elem("xr",pos[0]));
+    genOut (INDENT"%s = tr - ti;\n", elem("xi",pos[0]));
+
+    for (k=1; 2*k<h; ++k) {
+        const int     p = pos[k], q = pos[h-k];
+        const double  a = 2.*M_PI*(-k)/n;
+        const double  r = M_PI*(-k)/(2*n);
+
+        // P*[k] and Q[k]
+        genTwiddle ("ur", "ui", elem("xr",p), 0, elem("xi",p), 0,
+                    0.5*cos(r), 0.5*sin(r), 0, &trz, &tiz);
+        genTwiddle ("vr", "vi", elem("xr",q), 0, elem("xi",q), 0,
+                    0.5*cos(r+M_PI/4), -0.5*sin(r+M_PI/4), 0, &trz, &tiz);
+
+        // (P[k] - Q[k])*, E[k], and O*[k]
+        genOut (INDENT"tr = ur - vr;\n");
+        genOut (INDENT"ti = ui + vi;\n");
+        genOut (INDENT"ur += vr;\n");
+        genOut (INDENT"ui = vi - ui;\n");
+        genTwiddle ("vr", "vi", "tr", 0, "ti", 0, cos(a), sin(a), 0,
+                    &trz, &tiz);
+
+        // Z[k] and Z[h-k]
+        genOut (INDENT"%s = ur + vi;\n", elem("xr",p));
+        genOut (INDENT"%s = ui + vr;\n", elem("xi",p));
+        genOut (INDENT"%s = ur - vi;\n", elem("xr",q));
+        genOut (INDENT"%s = vr - ui;\n", elem("xi",q));
+    }
+
+    // Z[h/2]
+    if (h%2 == 0) {
+        const int     p = pos[h/2];
+        const double  r = M_PI*h/(4*n);
+        genOut (INDENT"tr = %s;\n", elem("xr",p));
+        genTwiddle (elem("xr",p), elem("xi",p), "tr", 0, elem("xi",p), 0,
+                    cos(r), -sin(r), 0, &trz, &tiz);
+    }
+
+    genOut ("\n");
+}
+
+
+
+//==============================================================================
+// Code generating function for an MDCT or IMDCT
+//
+// Generates the code for the MDCT
+//   X[k] = sum_j(w[j]*x[j] * cos(2*pi/n*(j+1/2+n/4)*(k+1/2)))    k=0...n/2-1
+// of n real values stored in one array x[], or with inv set for the IMDCT
+//   y[j] = w[j] * sum_k(X[k] * cos(2*pi/n*(j+1/2+n/4)*(k+1/2)))  j=0...n-1
+// of the n/2 values X[k] stored in x[0]...x[n/2-1], with w[j]=sin(pi*(j+1/2)/n)
+// if window is set, otherwise w[j]=1. With h=n/2 the MDCT folds the input to
+// the h values
+//   u[j] = -x[3h/2-1-j] - x[3h/2+j]   for j<h/2
+//   u[j] =  x[j-h/2] - x[3h/2-1-j]    for j>=h/2
+// and computes their DCT-IV by the complex transform of length m=n/4:
+//   z[p] = exp(-i*pi*p/h) * (u[2p] + i*u[h-1-2p])
+//   Z    = DFT(z)
+//   X[2q] - i*X[h-1-2q] = exp(-i*pi*(q+1/4)/h) * Z[q]
+// The window, the folding, and the first rotation are merged into the constants
+// of one pass, which stores z[p] in two of its own four input values. A move
+// only permutation brings them into the input order of the transform. The
+// second rotation writes X[2q] and X[h-1-2q] together with X[2q'] and X[h-1-2q']
+// for q'=m-1-q in place, so the result is in natural order without a further
+// permutation. The IMDCT computes the DCT-IV v[] of X[] the same way, and unfolds
+// it to
+//   y[j] = v[h/2+j]                   for j<h/2
+//   y[j] = -v[3h/2-1-j]               for h/2<=j<3h/2
+//   y[j] = -v[j-3h/2]                 for j>=3h/2
+// The permutation after the transform moves each Z[q] to the two places of y[]
+// in the first half that are computed from it, so the second rotation, the
+// window, and the unfolding take one in place pass again.
+// n must be a multiple of 4.
+//
+
+static void  genMdct (
+    const int  n,             // Number of input values of the MDCT
+    const int  inv,           // Flag: !=0: IMDCT
+    const int  radix,         // Radix of the butterflies, 2 or 4
+    const int  split,         // Flag: !=0: Use the split-radix algorithm
+    const int  window         // Flag: !=0: Apply the sine window
+) {
+    const int  h = n/2;
+    const int  m = n/4;
+    int  *pos;                  // pos[p]: Index of element p at the input of
+                                //   the transform of length m
+    int  *src;                  // Source indices of the permutation
+    int  p, q, r, trz, tiz;
+
+    if (n < 4)  return;         // Nothing to do
+
+    pos = (int*)malloc (sizeof(int)*m);
+    src = (int*)malloc (sizeof(int)*n);
+    if (pos == NULL  ||  src == NULL) {
+        fprintf (stderr, "\n"LOGO": Error allocating memory: %s\n", strerror(errno));
+        exit (EXIT_FAILURE);
+    }
+    for (p=0; p<n; ++p)  src[p] = -1;
+
+    gen.realView = 1;
+
+    // None of the constants is zero or one, except the first rotation of z[0]
+    gen.eps     = 1e-12;
+    gen.epsOne  =  1.0 - 1e-12;
+    gen.epsMOne = -1.0 + 1e-12;
+
+    if ( ! inv) {
+        inputOrder (m, pos);
+
+        for (p=0; p<m; ++p) {
+            const int     ja = 2*p, jb = h-1-2*p;
+            const double  cr = cos (M_PI*p/h), ci = -sin (M_PI*p/h);
+            int     ix[4];              // Indices of the summands of u[ja]
+            double  c[4];               //   and u[jb] and their factors
+            const char  *s[4];
+            int     dr, di, j;
+
+            // u[ja] and u[jb]
+            for (j=0; j<2; ++j) {
+                const int  ju = j ? jb : ja;
+                if (2*ju < h) {
+                    ix[2*j]   = 3*m-1-ju;   c[2*j]   = -1.0;
+                    ix[2*j+1] = 3*m+ju;     c[2*j+1] = -1.0;
+                } else {
+                    ix[2*j]   = ju-m;       c[2*j]   =  1.0;
+                    ix[2*j+1] = 3*m-1-ju;   c[2*j+1] = -1.0;
+                }
+            }
+            for (j=0; j<4; ++j) {
+                if (window)  c[j] *= sin (M_PI*(ix[j]+0.5)/n);
+                s[j] = realElem (ix[j]);
+            }
+
+            // z[p] is stored in the places of one summand of u[ja] and u[jb],
+            // if possible in its place at the input of the transform
+            dr = ix[1] == 2*pos[p]   ? ix[1] : ix[0];
+            di = ix[3] == 2*pos[p]+1 ? ix[3] : ix[2];
+            src[2*pos[p]]   = dr;
+            src[2*pos[p]+1] = di;
+
+            if (p == 0) {
+                genLinComb (realElem(dr), 2, c, s);
+                genLinComb (realElem(di), 2, c+2, s+2);
+            } else if (window) {
+                const double  cRe[4] = {cr*c[0], cr*c[1], -ci*c[2], -ci*c[3]};
+                const double  cIm[4] = {ci*c[0], ci*c[1],  cr*c[2],  cr*c[3]};
+                genLinComb ("tr", 4, cRe, s);
+                genLinComb (realElem(di), 4, cIm, s);
+                genOut (INDENT"%s = tr;\n", realElem(dr));
+            } else {
+                genLinComb ("ur", 2, c, s);
+                genLinComb ("ui", 2, c+2, s+2);
+                genTwiddle (realElem(dr), realElem(di), "ur", 0, "ui", 0, cr, ci,
+                            0, &trz, &tiz);
+            }
+        }
+        genOut ("\n");
+
+        genRealPermutation (n, src);
+        fftGen (m, 0, 0, 0, 0, 0, radix, split, 0, 1, 0);
+
+        gen.eps     = 1e-12;
+        gen.epsOne  =  1.0 - 1e-12;
+        gen.epsMOne = -1.0 + 1e-12;
+        genOut ("\n");
+
+        // X[2q] and X[h-1-2q] from Z[q], the real and imaginary part of
+        // i*exp(-i*pi*(q+1/4)/h)*Z[q] being -X[h-1-2q] and X[2q]
+        for (q=0; 2*q<m-1; ++q) {
+            double  a = M_PI*(q+0.25)/h;
+            r = m-1-q;
+            genTwiddle ("ur", "tr", elem("xr",q), 0, elem("xi",q), 0,
+                        sin(a), cos(a), 0, &trz, &tiz);
+            a = M_PI*(r+0.25)/h;
+            genTwiddle (elem("xi",q), elem("xr",r), elem("xr",r), 0,
+                        elem("xi",r), 0, sin(a), cos(a), 0, &trz, &tiz);
+            genOut (INDENT"%s = tr;\n", elem("xr",q));
+            genOut (INDENT"%s = ur;\n", elem("xi",r));
+        }
+        if (m%2) {
+            const double  a = M_PI*(q+0.25)/h;
+            genOut (INDENT"tr = %s;\n", elem("xi",q));
+            genTwiddle (elem("xi",q), elem("xr",q), elem("xr",q), 0, "tr", 0,
+                        sin(a), cos(a), 0, &trz, &tiz);
+        }
+    } else {
+        // Decimation in frequency without bit reversal if possible, so the
+        // bit reversal is merged into the permutation after the transform
+        const int  dif = (m & (m-1)) == 0  &&  radix == 2  &&  ! split;
+
+        // z[p] and z[p'] for p'=m-1-p from X[2p], X[h-1-2p], X[2p'], and
+        // X[h-1-2p'], which are stored in the same places
+        for (p=0; 2*p<m-1; ++p) {
+            double  a = M_PI*p/h;
+            r = m-1-p;
+            genTwiddle ("tr", "ti", elem("xr",p), 0, elem("xi",r), 0,
+                        cos(a), -sin(a), 0, &trz, &tiz);
+            a = M_PI*r/h;
+            genTwiddle (elem("xi",r), elem("xr",r), elem("xi",p), 0,
+                        elem("xr",r), 0, cos(a), sin(a), 0, &trz, &tiz);
+            genOut (INDENT"%s = tr;\n", elem("xr",p));
+            genOut (INDENT"%s = ti;\n", elem("xi",p));
+        }
+        if (m%2) {
+            const double  a = M_PI*p/h;
+            genOut (INDENT"tr = %s;\n", elem("xr",p));
+            genTwiddle (elem("xr",p), elem("xi",p), "tr", 0, elem("xi",p), 0,
+                        cos(a), -sin(a), 0, &trz, &tiz);
+        }
+        genOut ("\n");
+
+        fftGen (m, 0, 0, 0, 0, 0, radix, split, dif, dif, 0);
+
+        gen.eps     = 1e-12;
+        gen.epsOne  =  1.0 - 1e-12;
+        gen.epsMOne = -1.0 + 1e-12;
+        genOut ("\n");
+
+        // Z[q] to the places of y[] in the first half computed from it
+        for (q=0; q<m; ++q) {
+            const int  jh = 2*q < m ? h-1-2*q : 2*q;    // v[jh] goes there
+            src[jh-m]     = 2*(dif ? bitRev (q, m) : q);
+            src[3*m-1-jh] = src[jh-m] + 1;
+        }
+        genRealPermutation (n, src);
+
+        // v[2q] and v[h-1-2q], the real and the negative imaginary part of
+        // exp(-i*pi*(q+1/4)/h)*Z[q], to y[]
+        for (q=0; q<m; ++q) {
+            const double  a = M_PI*(q+0.25)/h;
+            const int     jh = 2*q < m ? h-1-2*q : 2*q;     // Index of v[]
+            const int     jl = 2*q < m ? 2*q : h-1-2*q;     //   in each half
+            const int     ia = jh-m, ib = 3*m-1-jh;     // Places of Z[q]
+            const int     ic = 3*m-1-jl, id = 3*m+jl;
+            const double  re[2] = {cos(a), sin(a)};     // Factors of the real
+            const double  im[2] = {sin(a), -cos(a)};    //   and neg. imaginary
+            const double *ch = jh == 2*q ? re : im;     //   part, for v[jh]
+            const double *cl = jh == 2*q ? im : re;     //   and for v[jl]
+            const char   *s[2];
+
+            s[0] = realElem (ia);
+            s[1] = realElem (ib);
+            if (window) {
+                const double  wa = sin (M_PI*(ia+0.5)/n);
+                const double  wb = sin (M_PI*(ib+0.5)/n);
+                const double  wc = sin (M_PI*(ic+0.5)/n);
+                const double  wd = sin (M_PI*(id+0.5)/n);
+                const double  cc[2] = {-wc*cl[0], -wc*cl[1]};
+                const double  cd[2] = {-wd*cl[0], -wd*cl[1]};
+                const double  ca[2] = { wa*ch[0],  wa*ch[1]};
+                const double  cb[2] = {-wb*ch[0], -wb*ch[1]};
+                genLinComb (realElem(ic), 2, cc, s);
+                genLinComb (realElem(id), 2, cd, s);
+                genLinComb ("tr", 2, ca, s);
+                genLinComb (realElem(ib), 2, cb, s);
+                genOut (INDENT"%s = tr;\n", realElem(ia));
+            } else {
+                const double  cn[2] = {-cl[0], -cl[1]};
+                genLinComb ("tr", 2, ch, s);
+                genLinComb ("ti", 2, cn, s);
+                genOut (INDENT"%s = ti;\n", realElem(ic));
+                genOut (INDENT"%s = ti;\n", realElem(id));
+                genOut (INDENT"%s = tr;\n", realElem(ia));
+                genOut (INDENT"%s = - tr;\n", realElem(ib));
+            }
+        }
+    }
+    genOut ("\n");
+
+    gen.realView = 0;
+
+    free (pos);
+    free (src);
+}
+
+
+
+//==============================================================================
+// Generate code for a permutation of the real values of array x[]
+//
+// Generates the code to move x[src[p]] to x[p] for p=0...n-1 like
+// genPermutation() does for the complex elements. src[p]<0 denotes that the
+// value stored at p is not required afterwards, so the moves form chains
+// starting at such places besides the cycles, see genMdct().
+//
+
+static void  genRealPermutation (
+    const int   n,            // Number of real values
+    const int  *src           // src[p]: Index of the value moved to p, or -1
+) {
+    int  *done;                 // done[p]: Flag: value p has been moved
+    int  *used;                 // used[p]: Flag: value p is moved elsewhere
+    int  i, p;
+
+    done = (int*)malloc (sizeof(int)*n);
+    used = (int*)malloc (sizeof(int)*n);
+    if (done == NULL  ||  used == NULL) {
+        fprintf (stderr, "\n"LOGO": Error allocating memory: %s\n", strerror(errno));
+        exit (EXIT_FAILURE);
+    }
+    for (i=0; i<n; ++i)  done[i] = used[i] = 0;
+    for (i=0; i<n; ++i) {
+        if (src[i] >= 0  &&  src[i] != i)  used[src[i]] = 1;
+    }
+
+    // Chains i <- src[i] <- src[src[i]] <- ... ending at a value not moved
+    for (i=0; i<n; ++i) {
+        if (used[i]  ||  src[i] < 0  ||  src[i] == i)  continue;
+
+        for (p=i; src[p]>=0 && src[p]!=p; p=src[p]) {
+            genOut (INDENT"%s = %s;\n", realElem(p), realElem(src[p]));
+            done[p] = 1;
+        }
+    }
+
+    for (i=0; i<n; ++i) {
+        if (done[i]  ||  src[i] < 0  ||  src[i] == i)  continue;
+
+        // Implement the cycle i <- src[i] <- src[src[i]] <- ... <- i
+        genOut (INDENT"tr = %s;\n", realElem(i));
+        for (p=i; src[p]!=i; p=src[p]) {
+            genOut (INDENT"%s = %s;\n", realElem(p), realElem(src[p]));
+            done[p] = 1;
+        }
+        genOut (INDENT"%s = tr;\n", realElem(p));
+        done[p] = 1;
+    }
+    genOut ("\n");
+
+    free (done);
+    free (used);
+}
+
+
+
+//==============================================================================
+// Generate code for Rader's algorithm
+//
+// For n=p being a prime and g a primitive root modulo p, i.e. the powers
+// g^m mod p, m=0...p-2, run through the indices 1...p-1, the DFT of length p is
+// rewritten as
+//   X[0]      = x[0] + sum_m(a[m])
+//   X[g^-q]   = x[0] + sum_m(a[m] * b[q-m])
+// for q=0...p-2 with a[m]=x[g^m] and b[m]=W^(g^-m), W=exp(-2*pi*i/p). The sum
+// is a cyclic convolution of length p-1. It is computed by the transforms A and
+// B of a and b: the inverse transform of A[k]*B[k]/(p-1) yields the sum. The
+// transforms of length p-1 are generated by fftGen() for the elements
+// x[1]...x[p-1], see gen.offset.
+// The transform B, including the factor 1/(p-1), is computed at generation
+// time and inserted as literal constants. B[0]=-1/(p-1) is real, so x[0] is
+// added to the product at k=0, which adds it to all results of the inverse
+// transform. The permutation to a[], the digit reversal of the forward
+// transform, the multiplication by B, and the digit reversal of the inverse
+// transform are combined to two passes of genPermutation(). A final pass moves
+// the results to their natural order. If the transforms of length p-1 use the
+// prime factor algorithm there is no digit reversal to be combined.
+// p-1 must be a product of the prime factors 2, 3, 5, and 7.
+//
+
+static void  genRader (void)
+{
+    const GEN  saved = gen;
+    const int  p = gen.n;
+    const int  inv = gen.inv;
+    int  f[32];                 // Prime factors of p-1
+    int  *gp;                   // gp[m] = g^m mod p
+    int  *src;                  // Source indices of the permutations
+    double  *br, *bi;           // B[k]/(p-1)
+    int  g, m, k, q;
+
+    // Use the split-radix algorithm if p-1 is a power of two
+    const int  split = ((p-1) & (p-2)) == 0;
+    // The prime factor algorithm needs no digit reversal, see genPrimeFactor()
+    const int  pfa = coprimeFactors (p-1, NULL) > 1;
+
+    gp  = (int*)malloc (sizeof(int)*(p-1));
+    src = (int*)malloc (sizeof(int)*(p-1));
+    br  = (double*)malloc (sizeof(double)*(p-1));
+    bi  = (double*)malloc (sizeof(double)*(p-1));
+    if (gp == NULL  ||  src == NULL  ||  br == NULL  ||  bi == NULL) {
+        fprintf (stderr, "\n"LOGO": Error allocating memory: %s\n", strerror(errno));
+        exit (EXIT_FAILURE);
+    }
+
+    //--------------------------------------------------------------------------
+    // Find the smallest primitive root g and the powers g^m
+
+    for (g=2; ; ++g) {
+        gp[0] = 1;
+        for (m=1; m<p-1; ++m) {
+            gp[m] = (int)((long)gp[m-1]*g % p);
+            if (gp[m] == 1)  break;
+        }
+        if (m == p-1)  break;
+    }
+
+    //--------------------------------------------------------------------------
+    // Transform B[k]/(p-1) of b[m]=W^(g^-m)
+
+    for (k=0; k<p-1; ++k) {
+        br[k] = bi[k] = 0.0;
+        for (m=0; m<p-1; ++m) {
+            double  a = 2.*M_PI*(-gp[(p-1-m)%(p-1)])/p;
+            double  c = 2.*M_PI*(-(double)((long)m*k%(p-1)))/(p-1);
+            if (inv)  a = -a;       // Prepare inverse FFT
+            br[k] += cos(a)*cos(c) - sin(a)*sin(c);
+            bi[k] += cos(a)*sin(c) + sin(a)*cos(c);
+        }
+        br[k] /= p-1;
+        bi[k] /= p-1;
+    }
+
+    factorize (p-1, f);
+
+    //--------------------------------------------------------------------------
+    // Forward transform of a[], in digit reversed order
+
+    gen.n      = p-1;
+    gen.offset = saved.offset + gen.stride;
+    for (m=0; m<p-1; ++m)  src[pfa ? m : digitRev(m,f)] = gp[m] - 1;
+    genPermutation (src, NULL, NULL);
+    fftGen (p-1, 0, 0, 0, 0, 0, 2, split, 0, 1, 0);
+
+    //--------------------------------------------------------------------------
+    // X[0] and A[0]*B[0]+x[0], B[0]=-1/(p-1)
+
+    gen.offset = saved.offset;
+    for (q=0; genBlock(q); ++q) {
+        genOut (INDENT"tr = %s;\n", elem("xr",0));
+        genOut (INDENT"ti = %s;\n", elem("xi",0));
+        genOut (INDENT"%s += %s;\n", elem("xr",0), elem("xr",1));
+        genOut (INDENT"%s += %s;\n", elem("xi",0), elem("xi",1));
+        genOut (INDENT"%s = tr - %s*%s;\n", elem("xr",1), constant(-br[0]), elem("xr",1));
+        genOut (INDENT"%s = ti - %s*%s;\n", elem("xi",1), constant(-br[0]), elem("xi",1));
+    }
+
+    //--------------------------------------------------------------------------
+    // Inverse transform of A[k]*B[k]/(p-1), multiplied in digit reversed order
+
+    gen.n       = p-1;
+    gen.offset  = saved.offset + gen.stride;
+    gen.eps     = 1e-10;        // B[k] is neither zero nor one for k>0
+    gen.epsOne  =  1.0 - 1e-10;
+    gen.epsMOne = -1.0 + 1e-10;
+    br[0] = 1.0;                // Already done
+    bi[0] = 0.0;
+    for (k=0; k<p-1; ++k)  src[pfa ? k : digitRev(k,f)] = k;
+    genPermutation (src, br, bi);
+    fftGen (p-1, 1, 0, 0, 0, 0, 2, split, 0, 1, 0);
+
+    //--------------------------------------------------------------------------
+    // Move X[g^-q] from index q+1 to index g^-q
+
+    gen.n = p-1;
+    for (q=0; q<p-1; ++q)  src[gp[(p-1-q)%(p-1)]-1] = q;
+    genPermutation (src, NULL, NULL);
+
+    gen = saved;
+
+    free (gp);
+    free (src);
+    free (br);
+    free (bi);
+}
+
+
+
+//==============================================================================
+// Generate code for the Bluestein algorithm
+//
+// Computes the chirp z-transform of the n input values x[j]
+//   X[k] = sum_j(x[j] * W^(j*(f0+k*df))),    W=exp(-2*pi*i/n)
+// for the m bins k=0...m-1, i.e. the transform at the frequencies f0+k*df in
+// units of the bin spacing of the DFT. For f0=0, df=1, and m=n this is the DFT
+// of arbitrary length n. With j*k=(j^2+k^2-(k-j)^2)/2 and the chirp
+// c[j]=W^(df*j^2/2) the sum is rewritten as
+//   X[k] = c[k] * sum_j(x[j]*W^(f0*j)*c[j] * c*[k-j])
+// which is a convolution. It is computed as cyclic convolution of length L,
+// the smallest power of two with L>=n+m-1:
+// 1. The input values are multiplied by W^(f0*j)*c[j]. The elements n...L-1
+//    are regarded as zero, they don't need to be initialized.
+// 2. The transform of length L is computed by decimation in frequency, which
+//    omits the operations on the zero elements. The result is left in bit
+//    reversed order.
+// 3. The result is multiplied by the transform of c*[k], k=-(n-1)...m-1, and
+//    by 1/L, precomputed at generation time, in bit reversed order.
+// 4. The inverse transform is computed with the split-radix algorithm from the
+//    bit reversed order.
+// 5. The results X[0]...X[m-1] are multiplied by c[k].
+// All constants are inserted into the generated code as literals. The inverse
+// transform uses the conjugated factors W*. The arrays xr and xi must be of
+// size L.
+//
+
+static void  genBluestein (
+    const int     n,          // Number of input values
+    const int     inv,        // Flag: !=0: inverse transform
+    const int     m,          // Number of bins
+    const double  f0,         // Frequency of the first bin
+    const double  df          // Frequency spacing of the bins
+) {
+    const double  sign = inv ? 1. : -1.;    // Sign of the exponent of W
+    double  *hr, *hi;           // Transform of the chirp c*
+    double  *cs, *sn;           // cos() and sin() of 2*pi*j/L
+    double  a;
+    int  L, j, k, d, trz, tiz;
+
+    for (L=1; L<n+m-1; L*=2)  ;
+
+    hr = (double*)malloc (sizeof(double)*L);
+    hi = (double*)malloc (sizeof(double)*L);
+    cs = (double*)malloc (sizeof(double)*L);
+    sn = (double*)malloc (sizeof(double)*L);
+    if (hr == NULL  ||  hi == NULL  ||  cs == NULL  ||  sn == NULL) {
+        fprintf (stderr, "\n"LOGO": Error allocating memory: %s\n", strerror(errno));
+        exit (EXIT_FAILURE);
+    }
+
+    //--------------------------------------------------------------------------
+    // Transform of c*[d], d=-(n-1)...m-1, stored cyclically at index d mod L
+
+    for (j=0; j<L; ++j) {
+        cs[j] = cos (2.*M_PI*j/L);
+        sn[j] = sin (2.*M_PI*j/L);
+    }
+    for (k=0; k<L; ++k) {
+        hr[k] = hi[k] = 0.;
+        for (d=-(n-1); d<m; ++d) {
+            const int  e = (int)((long)(d+L)*k % L);
+            a = -sign*M_PI*fmod (df*(double)d*d, 2.*n)/n;
+            hr[k] += cos(a)*cs[e] + sin(a)*sn[e];   // c*[d] * exp(-2*pi*i*d*k/L)
+            hi[k] += sin(a)*cs[e] - cos(a)*sn[e];
+        }
+        hr[k] /= L;
+        hi[k] /= L;
+    }
+
+    // The factors are neither rounded to zero nor to one
+    gen.eps     = 1e-12;
+    gen.epsOne  =  1.0 - 1e-12;
+    gen.epsMOne = -1.0 + 1e-12;
+
+    //--------------------------------------------------------------------------
+    // 1. Multiply the input by W^(f0*j)*c[j]
+
+    for (j=1; j<n; ++j) {
+        a = sign*M_PI*(fmod (2.*f0*j, 2.*n) + fmod (df*(double)j*j, 2.*n))/n;
+        genOut (INDENT"tr = %s;\n", elem("xr",j));
+        genTwiddle (elem("xr",j), elem("xi",j), "tr", 0, elem("xi",j), 0,
+                    cos(a), sin(a), 0, &trz, &tiz);
+    }
+    genOut ("\n");
+
+    //--------------------------------------------------------------------------
+    // 2. Transform of length L, the elements n...L-1 are zero
+
+    gen.nIn = n;
+    fftGen (L, 0, 0, 0, 0, 0, 2, 0, 1, 1, 0);
+    gen.nIn = 0;
+
+    //--------------------------------------------------------------------------
+    // 3. Multiply by the transform of c* in bit reversed order
+
+    gen.eps     = 1e-12;
+    gen.epsOne  =  1.0 - 1e-12;
+    gen.epsMOne = -1.0 + 1e-12;
+    genOut ("\n");
+    for (j=0; j<L; ++j) {
+        k = bitRev (j, L);
+        genOut (INDENT"tr = %s;\n", elem("xr",j));
+        genTwiddle (elem("xr",j), elem("xi",j), "tr", 0, elem("xi",j), 0,
+                    hr[k], hi[k], 0, &trz, &tiz);
+        if (trz)  genOut (INDENT"%s = 0.0;\n", elem("xr",j));
+        if (tiz)  genOut (INDENT"%s = 0.0;\n", elem("xi",j));
+    }
+    genOut ("\n");
+
+    //--------------------------------------------------------------------------
+    // 4. Inverse transform from bit reversed order
+
+    fftGen (L, 1, 0, 0, 0, 0, 2, 1, 0, 1, 0);
+
+    //--------------------------------------------------------------------------
+    // 5. Multiply the result by c[k]
+
+    gen.eps     = 1e-12;
+    gen.epsOne  =  1.0 - 1e-12;
+    gen.epsMOne = -1.0 + 1e-12;
+    genOut ("\n");
+    for (k=1; k<m; ++k) {
+        a = sign*M_PI*fmod (df*(double)k*k, 2.*n)/n;
+        genOut (INDENT"tr = %s;\n", elem("xr",k));
+        genTwiddle (elem("xr",k), elem("xi",k), "tr", 0, elem("xi",k), 0,
+                    cos(a), sin(a), 0, &trz, &tiz);
+    }
+
+    free (hr);
+    free (hi);
+    free (cs);
+    free (sn);
+}
+
+
+
+//==============================================================================
+// Generate code for the prime factor algorithm
+//
+// For n=q[0]*...*q[L-1] with pairwise coprime factors q[l], see
+// coprimeFactors(), the Good-Thomas algorithm maps the index j to the L-tuple
+// (j[0],...,j[L-1]) with j = sum_l(j[l]*N[l]) mod n, N[l]=n/q[l]. With the
+// same map for the index k of the transform all cross terms j[l]*k[m]*N[l]*N[m],
+// l!=m, are multiples of n, so W^(j*k)=prod_l(V[l]^(r[l]*j[l]*k[l])) with
+// V[l]=exp(-2*pi*i/q[l]) and r[l]=N[l] mod q[l]. The transform is thus an
+// L-dimensional DFT without any twiddle factors between the dimensions. It is
+// computed in place dimension by dimension: for each l the q[l] elements
+// x[(b+j*N[l]) mod n], j=0...q[l]-1, with b running over the multiples of
+// q[l], are passed through a "rotated" DFT of length q[l] using V[l]^r[l] in
+// place of V[l]. As input and output share the index map no permutation is
+// required at all.
+// The rotated DFTs of prime length are radix-2 butterflies or rotated
+// radix-3, -5, or -7 butterflies, see genPrimeButterfly(). Those of prime
+// powers, e.g. 8 or 9, are generated by genMixedRadix() on the elements
+// selected by gen.map.
+//
+
+static void  genPrimeFactor (void)
+{
+    const int  n = gen.n;
+    int  q[4];                  // Coprime factors of n
+    int  *pos;                  // Indices of the elements of one DFT
+    int  nq, l, N, r, b, j, k, trz, tiz;
+
+    nq = coprimeFactors (n, q);
+
+    pos = (int*)malloc (sizeof(int)*n);
+    if (pos == NULL) {
+        fprintf (stderr, "\n"LOGO": Error allocating memory: %s\n", strerror(errno));
+        exit (EXIT_FAILURE);
+    }
+
+    for (l=0; l<nq; ++l) {
+        N = n / q[l];
+        r = N % q[l];
+        for (b=0; b<n; b+=q[l]) {
+            for (j=0; j<q[l]; ++j)  pos[j] = (b + j*N) % n;
+
+            if (q[l] == 2) {
+                for (k=0; genBlock(k); ++k) {
+                    genTwiddle ("tr", "ti", elem("xr",pos[1]), 0, elem("xi",pos[1]),
+                                ! gen.nzi[pos[1]], 1.0, 0.0, 0, &trz, &tiz);
+                    genButterfly (pos[0], pos[1], "tr", "ti", trz, tiz, 0, 0);
+                }
+            } else if (isPrime (q[l])) {
+                for (k=0; genBlock(k); ++k) {
+                    genPrimeButterfly (q[l], pos, 0, 1, r);
+                }
+            } else {
+                gen.n   = q[l];
+                gen.map = pos;
+                genMixedRadix (r);
+                gen.map = NULL;
+                gen.n   = n;
+            }
+        }
+    }
+
+    free (pos);
+}
+
+
+
+//==============================================================================
+// Generate code for a mixed radix transform
+//
+// For n being the product of the prime factors f[0]...f[L-1] out of 2, 3, 5,
+// and 7 the decimation in time transform is computed in L stages. The sequence
+// is first brought into digit reversed order, see digitRev(). Stage s
+// then combines the transforms of length m=f[s+1]*...*f[L-1] of f[s]
+// subsequences to transforms of length f[s]*m, i.e. for each k=0...m-1 the
+// elements x[k+j*m], j=0...f[s]-1, are multiplied by the twiddle factors
+// W^(j*k), W=exp(-2*pi*i/(f[s]*m)), and passed through a radix-f[s] butterfly.
+// The stages are computed from s=L-1 down to s=0.
+// The factors of two come first, so the butterflies of the odd radices are
+// computed in the first stages where they need less twiddle factors.
+// If rot is 0 the sequence is expected in digit reversed order already, see
+// genRader(). Otherwise the rotated DFT using W^rot in place of W is computed,
+// see genPrimeFactor(). As this is the DFT of x[j/rot mod n] the division is
+// folded into the digit reversal permutation.
+//
+
+static void  genMixedRadix (
+    const int  rot            // Rotation of the DFT, 0: Sequence is in digit
+                              //   reversed order
+) {
+    const int  n = gen.n;
+    int  f[32];                 // Prime factors of n
+    int  nf;                    // Number of prime factors
+    int  *ix;                   // Indices of the elements of one butterfly
+    int  s, m, r, k, b, j, i, ri;
+
+    factorize (n, f);
+    for (nf=0; f[nf]; ++nf)  ;
+
+    ix = (int*)malloc (sizeof(int)*n);
+    if (ix == NULL) {
+        fprintf (stderr, "\n"LOGO": Error allocating memory: %s\n", strerror(errno));
+        exit (EXIT_FAILURE);
+    }
+
+    if (rot) {
+        for (ri=1; (long)ri*rot % n != 1  &&  n > 1; ++ri)  ;   // ri = 1/rot mod n
+        for (j=0; j<n; ++j)  ix[digitRev(j,f)] = (int)((long)j*ri % n);
+        genPermutation (ix, NULL, NULL);
+    }
+
+    for (s=nf-1,m=1; s>=0; m*=f[s],--s) {
+        r = f[s];
+        for (k=0; k<m; ++k) {
+            for (b=0; b<n; b+=r*m) {
+                if (r == 2) {
+                    double  a  = M_PI*(-k)/m;
+                    double  wr = cos (a);
+                    double  wi = sin (a);
+                    int  trz, tiz;      // Flags: tr, ti is zero
+                    if (gen.inv)  wi = -wi;     // Prepare inverse FFT
+
+                    j = b+k+m;
+                    for (i=0; genBlock(i); ++i) {
+                        genTwiddle ("tr", "ti", elem("xr",j), 0, elem("xi",j),
+                                    ! gen.nzi[j], wr, wi, 0, &trz, &tiz);
+                        genButterfly (b+k, j, "tr", "ti", trz, tiz, 0, 0);
+                    }
+                } else {
+                    for (j=0; j<r; ++j)  ix[j] = b+k+j*m;
+                    for (i=0; genBlock(i); ++i) {
+                        genPrimeButterfly (r, ix, k, r*m, 1);
+                    }
+                }
+            }
+        }
+    }
+
+    free (ix);
+}
+
+
+
+//==============================================================================
+// Generate code for a permutation of the sequence
+//
+// Generates the code to move element x[src[p]] to index p for p=0...n-1, e.g.
+// the digit reversal permutation required by the mixed radix transform, see
+// digitRev(). The permutation is conducted cycle by cycle, each cycle requiring
+// the temporaries tr and ti.
+// If wr and wi are not NULL then each element x[q] is multiplied by the factor
+// wr[q]+i*wi[q] while it is moved. This requires the temporaries ur and ui for
+// the elements which are not moved but multiplied.
+//
+
+static void  genPermutation (
+    const int     *src,       // src[p]: Index of the element moved to p
+    const double  *wr,        // Real parts of the factors or NULL
+    const double  *wi         // Imaginary parts of the factors or NULL
+) {
+    const int  n = gen.n;
+    int  *done;                 // done[p]: Flag: element p has been moved
+    int  i, p, q, b, trz, tiz;
+
+    done = (int*)malloc (sizeof(int)*n);
+    if (done == NULL) {
+        fprintf (stderr, "\n"LOGO": Error allocating memory: %s\n", strerror(errno));
+        exit (EXIT_FAILURE);
+    }
+    for (i=0; i<n; ++i)  done[i] = 0;
+
+    for (i=0; i<n; ++i) {
+        if (done[i])  continue;
+        for (b=0; genBlock(b); ++b) {
+            if (src[i] == i) {
+                // Element is not moved, only multiplied by the factor if not
+                // one
+                if (   wr == NULL
+                    || (wr[i] >= gen.epsOne  &&  fabs(wi[i]) <= gen.eps)) {
+                    continue;
+                }
+                if (fabs(wi[i]) <= gen.eps) {
+                    genOut (INDENT"%s *= %s;\n", elem("xr",i), constant(wr[i]));
+                    genOut (INDENT"%s *= %s;\n", elem("xi",i), constant(wr[i]));
+                } else {
+                    genTwiddle ("ur", "ui", elem("xr",i), 0, elem("xi",i), 0,
+                                wr[i], wi[i], 0, &trz, &tiz);
+                    genOut (INDENT"%s = %s;\n", elem("xr",i), trz ? "0.0" : "ur");
+                    genOut (INDENT"%s = %s;\n", elem("xi",i), tiz ? "0.0" : "ui");
+                }
+                continue;
+            }
+
+            // Implement the cycle i <- src[i] <- src[src[i]] <- ... <- i
+            genOut (INDENT"tr = %s;\n", elem("xr",i));
+            genOut (INDENT"ti = %s;\n", elem("xi",i));
+            for (p=i; src[p]!=i; p=q) {
+                q = src[p];
+                if (wr == NULL) {
+                    genOut (INDENT"%s = %s;\n", elem("xr",p), elem("xr",q));
+                    genOut (INDENT"%s = %s;\n", elem("xi",p), elem("xi",q));
+                } else {
+                    genTwiddle (elem("xr",p), elem("xi",p), elem("xr",q), 0,
+                                elem("xi",q), 0, wr[q], wi[q], 0, &trz, &tiz);
+                    if (trz)  genOut (INDENT"%s = 0.0;\n", elem("xr",p));
+                    if (tiz)  genOut (INDENT"%s = 0.0;\n", elem("xi",p));
+                }
+                done[p] = 1;
+            }
+            if (wr == NULL) {
+                genOut (INDENT"%s = tr;\n", elem("xr",p));
+                genOut (INDENT"%s = ti;\n", elem("xi",p));
+            } else {
+                genTwiddle (elem("xr",p), elem("xi",p), "tr", 0, "ti", 0,
+                            wr[i], wi[i], 0, &trz, &tiz);
+                if (trz)  genOut (INDENT"%s = 0.0;\n", elem("xr",p));
+                if (tiz)  genOut (INDENT"%s = 0.0;\n", elem("xi",p));
+            }
+            done[p] = 1;
+        }
+    }
+    genOut ("\n");
+
+    free (done);
+}
+
+
+
+//==============================================================================
+// Generate code for a radix-3, -5, or -7 butterfly
+//
+// The butterfly operates on the p elements x[ix[j]], j=0...p-1. For the stage
+// of a mixed radix transform with m=f[s+1]*...*f[L-1] these are x[i0+j*m] with
+// k=i0%m and pm=p*m, see genMixedRadix(). With a[j] denoting these elements
+// multiplied by the twiddle factors W^(j*k), W=exp(-2*pi*i/pm),
+// c(q)=cos(2*pi*rot*q/p), and s(q)=sin(2*pi*rot*q/p) the DFT of length p is
+// computed as
+//   b[j]   = a[j] + a[p-j],    b[p-j] = a[j] - a[p-j]
+//   R[q]   = a[0] + sum_j(c(q*j) * b[j])
+//   I[q]   = sum_j(s(q*j) * b[p-j])
+//   X[q]   = R[q] - i*I[q],    X[p-q] = R[q] + i*I[q]
+//   X[0]   = a[0] + sum_j(b[j])
+// for q=1...(p-1)/2, the sums running over j=1...(p-1)/2. For the inverse FFT
+// the signs of i*I[q] are exchanged. A rotation rot other than 1 yields the
+// rotated DFT of the prime factor algorithm, see genPrimeFactor(), at the
+// cost of different constants only.
+// The generated code requires the temporaries tr, ti, ur, ui, and the arrays br
+// and bi of size p.
+//
+
+static void  genPrimeButterfly (
+    const int   p,            // Radix, 3, 5, or 7
+    const int  *ix,           // Indices of the sequence elements
+    const int   k,            // Twiddle factors are W^(j*k), 0: none
+    const int   pm,           //   with W=exp(-2*pi*i/pm)
+    const int   rot           // Rotation of the DFT, 1: none
+) {
+    const int  i0 = ix[0];
+    int  j, q, len;
+    char  lr[LINELEN], li[LINELEN], lu[LINELEN], lv[LINELEN];
+
+    //--------------------------------------------------------------------------
+    // Implement b[j] = a[j] + a[p-j], b[p-j] = a[j] - a[p-j]
+
+    for (j=1; 2*j<p; ++j) {
+        const int  ij = ix[j];
+        const int  il = ix[p-j];
+        const char  *ar = elem("xr",ij), *ai = elem("xi",ij);
+        const char  *vr = elem("xr",il), *vi = elem("xi",il);
+        int  arz = 0, aiz = ! gen.nzi[ij];      // Flags: a[j] is zero
+        int  vrz = 0, viz = ! gen.nzi[il];      // Flags: a[p-j] is zero
+
+        if (k != 0) {
+            // Multiply by the twiddle factors, otherwise these are one
+            double  a = 2.*M_PI*(-j*k)/pm;
+            if (gen.inv)  a = -a;       // Prepare inverse FFT
+            genTwiddle ("tr", "ti", ar, arz, ai, aiz, cos(a), sin(a), 0,
+                        &arz, &aiz);
+            a = 2.*M_PI*(-(p-j)*k)/pm;
+            if (gen.inv)  a = -a;       // Prepare inverse FFT
+            genTwiddle ("ur", "ui", vr, vrz, vi, viz, cos(a), sin(a), 0,
+                        &vrz, &viz);
+            ar = "tr";  ai = "ti";
+            vr = "ur";  vi = "ui";
+        }
+        if (genSum (elem("br",j), ar, arz, '+', vr, vrz))  genOut (INDENT"br[%d] = 0.0;\n", j);
+        if (genSum (elem("bi",j), ai, aiz, '+', vi, viz))  genOut (INDENT"bi[%d] = 0.0;\n", j);
+        if (genSum (elem("br",p-j), ar, arz, '-', vr, vrz))  genOut (INDENT"br[%d] = 0.0;\n", p-j);
+        if (genSum (elem("bi",p-j), ai, aiz, '-', vi, viz))  genOut (INDENT"bi[%d] = 0.0;\n", p-j);
+    }
+
+    //--------------------------------------------------------------------------
+    // Implement X[q] and X[p-q]
+
+    for (q=1; 2*q<p; ++q) {
+        snprintf (lr, LINELEN, INDENT"tr = %s", elem("xr",i0));
+        snprintf (li, LINELEN, INDENT"ti = %s", elem("xi",i0));
+        snprintf (lu, LINELEN, INDENT"ur =");
+        snprintf (lv, LINELEN, INDENT"ui =");
+        for (j=1; 2*j<p; ++j) {
+            const double  c  = cos (2.*M_PI*rot*q*j/p);
+            const double  sn = sin (2.*M_PI*rot*q*j/p);
+            const char    cs = c  < 0.0 ? '-' : '+';
+            const char    ss = sn < 0.0 ? '-' : '+';
+            len = strlen (lr);
+            snprintf (lr+len, LINELEN-len, " %c %s*br[%d]", cs, constant(fabs(c)), j);
+            len = strlen (li);
+            snprintf (li+len, LINELEN-len, " %c %s*bi[%d]", cs, constant(fabs(c)), j);
+            len = strlen (lu);
+            if (j == 1) {
+                snprintf (lu+len, LINELEN-len, " %s*br[%d]", constant(sn), p-j);
+            } else {
+                snprintf (lu+len, LINELEN-len, " %c %s*br[%d]", ss, constant(fabs(sn)), p-j);
+            }
+            len = strlen (lv);
+            if (j == 1) {
+                snprintf (lv+len, LINELEN-len, " %s*bi[%d]", constant(sn), p-j);
+            } else {
+                snprintf (lv+len, LINELEN-len, " %c %s*bi[%d]", ss, constant(fabs(sn)), p-j);
+            }
+        }
+        genOut ("%s;\n%s;\n%s;\n%s;\n", lr, li, lu, lv);
+
+        if ( ! gen.inv) {
+            // X[q] = R - i*I, X[p-q] = R + i*I
+            genOut (INDENT"%s = tr + ui;\n", elem("xr",ix[q]));
+            genOut (INDENT"%s = ti - ur;\n", elem("xi",ix[q]));
+            genOut (INDENT"%s = tr - ui;\n", elem("xr",ix[p-q]));
+            genOut (INDENT"%s = ti + ur;\n", elem("xi",ix[p-q]));
+        } else {
+            // X[q] = R + i*I, X[p-q] = R - i*I
+            genOut (INDENT"%s = tr - ui;\n", elem("xr",ix[q]));
+            genOut (INDENT"%s = ti + ur;\n", elem("xi",ix[q]));
+            genOut (INDENT"%s = tr + ui;\n", elem("xr",ix[p-q]));
+            genOut (INDENT"%s = ti - ur;\n", elem("xi",ix[p-q]));
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Implement X[0], last because a[0] is stored in its place
+
+    snprintf (lr, LINELEN, INDENT"%s +=", elem("xr",i0));
+    snprintf (li, LINELEN, INDENT"%s +=", elem("xi",i0));
+    for (j=1; 2*j<p; ++j) {
+        len = strlen (lr);
+        snprintf (lr+len, LINELEN-len, j==1 ? " br[%d]" : " + br[%d]", j);
+        len = strlen (li);
+        snprintf (li+len, LINELEN-len, j==1 ? " bi[%d]" : " + bi[%d]", j);
+    }
+    genOut ("%s;\n%s;\n", lr, li);
+
+    for (j=0; j<p; ++j)  gen.nzi[ix[j]] = 1;
+}
+
+
+
+//==============================================================================
+// Generate code for the binary inversion algorithm
+//
+// Generates the code to bring the sequence into bit reversed order before the
+// decimation in time transform. In case of symmIn the elements from index
+// n/2+1 onwards are not read but substituted by the conjugate complex values
+// of their symmetric counterparts.
+//
+
+static void  genBitRev (
+    const int  n,             // Number of points
+    const int  realIn,        // Flag: !=0: Optimize for real only input
+    const int  symmIn         // Flag: !=0: Optimize for symmetry at input
+) {
+    int  mr,nn,m,k,i,ii,b;
+
+    typedef
+        struct SwapSt {
+            int  m;         // m and mr will have to be swapped
+            int  mr;
+            int  m_new;     // m value to be used for the source of the
+                            // assignment insted of m at symmIn
+            int  mr_new;    // mr value to be used for the source of the
+                            // assignment insted of mr at symmIn
+            int  symmIn;    // Flag: Use the input symmetry relationship for
+                            // this element
+        } SWAP;
+    SWAP  *swap;
+    int  nSwap;             // Number of swap commands in array swap[]
+
+    nn = n-1;
+
+    // 1) Create the array swap[] to store the swapping commands to be conducted
+    //    later.
+    // 2) Fill it with the swapping commands of the binary inversion algorithm.
+    // 3) In case of symmIn create new source indices mr_new according to the
+    //    symmetry relationship x[m]=x*[mr_new=n-mr] (x* being the conjugate
+    //    complex value) if mr > n/2.
+    // 4) Check whether the new source index mr_new would have been overwritten
+    //    already before the current swapping.
+    //    - In that case insert the current swap command in the list before the
+    //      one which would overwrite mr_new.
+    // 5) Conduct the swapping commands in the order as now found in the array.
+
+    swap = (SWAP*)malloc (sizeof(SWAP)*n);
+    if (swap == NULL) {
+        fprintf (stderr, "\n"LOGO": Error allocating memory: %s\n", strerror(errno));
+        exit (EXIT_FAILURE);
+    }
+    for (i=0; i<n; ++i) {
+        swap[i].m = 0;
+        swap[i].mr = 0;
+        swap[i].m_new = 0;
+        swap[i].mr_new = 0;
+    }
+
+    //--------------------------------------------------------------------------
+    // Fill swap[] with the binary inversion swap commands and order the
+    // elements such that if the symmetry relationship is to be used the source
+    // elements are not overwritten
+
+    mr = 0;
+    for (nSwap=0,m=1; m<=nn; ++m) {
+        k = n;
+        do {
+            k /= 2;
+        } while (mr+k > nn);
+        mr = mr%k + k;
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // Prepare implementation of "if (mr > m)  SWAP(x[m],x[mr]);"
+
+                    // nSwap is the index of the current swap command in swap[]
+        if (mr > m) {
+            if ( ! symmIn) {
+                swap[nSwap].m = m;             // Swapping according to standard
+                swap[nSwap].mr = mr;           //    binary inversion algorithm
+                swap[nSwap].symmIn = 0;
+            } else {
+                // Optimize assuming input symmetry
+                swap[nSwap].m = m;
+                swap[nSwap].mr = mr;
+
+                if (m<=n/2 && mr<=n/2) {
+                    swap[nSwap].symmIn = 0;       // No symmetry subst. required
+                } else {
+                    int  i_m  = 0;
+                    int  i_mr = 0;
+                    int  m_new = m;
+                    int  mr_new = mr;
+
+                    if (m  > n/2)  m_new  = n - m ; // Use symmetry relationship
+                    if (mr > n/2)  mr_new = n - mr; //  "
+
+                    swap[nSwap].m_new = m_new;
+                    swap[nSwap].mr_new = mr_new;
+                    swap[nSwap].symmIn = 1;
+
+                    // Check whether the array element at the new mr (mr_new)
+                    // would have been assigned already
+
+                    if (m > n/2) {
+                        // Check whether m_new would have been overwritten by a
+                        // writing to element with index m or mr
+                        for (i_m=nSwap-1; i_m>0; --i_m) {
+                            if (m_new == swap[i_m].m || m_new == swap[i_m].mr)  break;
+                        }
+                    }
+                    if (mr > n/2) {
+                        // Check whether mr_new would have been overwritten by a
+                        // writing to element with index m or mr
+                        for (i_mr=nSwap-1; i_mr>0; --i_mr) {
+                            if (mr_new == swap[i_mr].m || mr_new == swap[i_mr].mr)  break;
+                        }
+                    }
+
+                    // Use the lowest of both and assign it to i_mr
+                    if (i_mr>0 && i_m>0) {
+                        if (i_mr>i_m)  i_mr = i_m;
+                    } else if (i_m>0) {
+                        i_mr = i_m;
+                    }
+
+                    // If the search ended successfully (i.e. before reaching 0)
+                    if (i_mr > 0) {
+                        // The array element at mr_new would have been assigned
+                        // already.
+                        // Create space in array swap[] at index i_mr, firstly
+                        // overwriting swap[nSwap]
+                        for (ii=nSwap; ii>i_mr; --ii) {
+                            swap[ii].m      = swap[ii-1].m ;
+                            swap[ii].mr     = swap[ii-1].mr;
+                            swap[ii].m_new  = swap[ii-1].m_new;
+                            swap[ii].mr_new = swap[ii-1].mr_new;
+                            swap[ii].symmIn = swap[ii-1].symmIn;
+                        }
+                        // Insert the new swap command at index ii, i.e.
+                        // before the command that would overwrite mr
+                        swap[i_mr].m = m;
+                        swap[i_mr].mr = mr;
+                        swap[i_mr].m_new = m_new;
+                        swap[i_mr].mr_new = mr_new;
+                        swap[i_mr].symmIn = 1;
+                    }
+                }
+            }
+            ++nSwap;
+        }
+    }
+    if (symmIn) {
+        // When optimizing assuming input symmetry then
+        //   check whether there are indices not yet considered.
+        // Therefore, check swap[] for not listed indices from n/2+1 onwards.
+        // Consider the symmetry relationship for those now.
+        // Note: This must be done before conducting the binary inversion
+        // algorithm because that will overwrite the elements with according
+        // indices.
+        for (i=n/2+1; i<n; ++i) {
+            for (ii=nSwap-1; ii>=0; --ii) {
+                if (swap[ii].m==i || swap[ii].mr==i)  break;
+            }
+            if (ii < 0) {   // i not listed in swap[]
+                for (b=0; genBlock(b); ++b) {
+                    genOut (INDENT"%s =  %s;\n", elem("xr",i), elem("xr",n-i));
+                    genOut (INDENT"%s = -%s;\n", elem("xi",i), elem("xi",n-i));
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Conduct swapping
+
+    for (k=0; k<nSwap; ++k) {
+        for (b=0; genBlock(b); ++b) {
+            //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+            // Implement  "if (mr > m)  SWAP(x[m],x[mr]);"
+            if ( ! swap[k].symmIn) {
+                // Swapping according to standard binary inversion algorithm
+                genOut (INDENT"tr = %s;\n", elem("xr",swap[k].m));
+                genOut (INDENT"%s = %s;\n", elem("xr",swap[k].m), elem("xr",swap[k].mr));
+                genOut (INDENT"%s = tr;\n", elem("xr",swap[k].mr));
+                if ( ! realIn) {
+                    genOut (INDENT"ti = %s;\n", elem("xi",swap[k].m));
+                    genOut (INDENT"%s = %s;\n", elem("xi",swap[k].m), elem("xi",swap[k].mr));
+                    genOut (INDENT"%s = ti;\n", elem("xi",swap[k].mr));
+                }
+            } else {
+                // Use the conjugate complex value of (xr[n-mr],xi[n-mr]) but only
+                // if the source index of the assignment would have been >n/2
+                genOut (INDENT"%s = %s;\n", elem("xr",swap[k].mr), elem("xr",swap[k].m_new));
+                genOut (INDENT"%s = %s;\n", elem("xr",swap[k].m), elem("xr",swap[k].mr_new));
+                if ( ! realIn) {
+                    if (swap[k].m <= n/2) {
+                        genOut (INDENT"%s = %s;\n", elem("xi",swap[k].mr), elem("xi",swap[k].m_new));
+                    } else {
+                        // Negating xi for the conjugate complex value is required
+                        genOut (INDENT"%s = -%s;\n", elem("xi",swap[k].mr), elem("xi",swap[k].m_new));
+                    }
+                    if (swap[k].mr <= n/2) {
+                        genOut (INDENT"%s = %s;\n", elem("xi",swap[k].m), elem("xi",swap[k].mr_new));
+                    } else {
+                        // Negating xi for the conjugate complex value is required
+                        genOut (INDENT"%s = -%s;\n", elem("xi",swap[k].m), elem("xi",swap[k].mr_new));
+                    }
+                }
+            }
+        }
+    }
+    genOut ("\n");
+
+    free (swap);
+}
+
+
+
+//==============================================================================
+// Generate code for the bit reversal permutation out of place
+//
+// Generates the code to gather the sequence from the input arrays xr_in and
+// xi_in into xr and xi in bit reversed order before the decimation in time
+// transform. As the input is not overwritten each element is assigned once, no
+// swaps and no temporaries are needed. With noBitRev the input is expected in
+// bit reversed order already and just copied. In case of symmIn the input
+// elements from index n/2+1 onwards are not read but substituted by the
+// conjugate complex values of their symmetric counterparts, in case of realIn
+// the imaginary parts are not read.
+//
+
+static void  genGather (
+    const int  noBitRev       // Flag: !=0: The input is in bit reversed order
+) {
+    const int  n = gen.n;
+    int  m, j, src, neg, b;
+
+    for (m=0; m<n; ++m) {
+        j   = bitRev (m, n);    // Index of the element in natural order
+        neg = gen.symmIn  &&  j > n/2;
+        if (neg)  j = n - j;
+        src = noBitRev ? bitRev (j, n) : j;
+        for (b=0; genBlock(b); ++b) {
+            genOut (INDENT"%s = %s;\n", elem("xr",m), elem("xr_in",src));
+            if ( ! gen.realIn) {
+                genOut (INDENT"%s = %s%s;\n", elem("xi",m), neg ? "-" : "",
+                        elem("xi_in",src));
+            }
+        }
+    }
+    genOut ("\n");
+}
+
+
+
+//==============================================================================
+// Generate code for the bit reversal permutation of the transform result
+//
+// Generates the code to bring the result of the decimation in frequency
+// transform from bit reversed into natural order. In case of symmOut only the
+// elements up to index n/2 are written, in case of realOut the imaginary parts
+// are not moved.
+//
+
+static void  genBitRevOut (void)
+{
+    const int  n = gen.n;
+    int  m, mr, b;
+
+    for (m=1; m<n; ++m) {
+        mr = bitRev (m, n);
+        if (mr > m) {
+            for (b=0; genBlock(b); ++b) {
+                if ( ! gen.symmOut  ||  mr <= n/2) {
+                    // Swap x[m] and x[mr]
+                    genOut (INDENT"tr = %s;\n", elem("xr",m));
+                    genOut (INDENT"%s = %s;\n", elem("xr",m), elem("xr",mr));
+                    genOut (INDENT"%s = tr;\n", elem("xr",mr));
+                    if ( ! gen.realOut) {
+                        genOut (INDENT"ti = %s;\n", elem("xi",m));
+                        genOut (INDENT"%s = %s;\n", elem("xi",m), elem("xi",mr));
+                        genOut (INDENT"%s = ti;\n", elem("xi",mr));
+                    }
+                } else if (m <= n/2) {
+                    // x[mr] is not required at output, so just move to x[m]
+                    genOut (INDENT"%s = %s;\n", elem("xr",m), elem("xr",mr));
+                    if ( ! gen.realOut) {
+                        genOut (INDENT"%s = %s;\n", elem("xi",m), elem("xi",mr));
+                    }
+                }
+            }
+        }
+    }
+}
+
+
+
+//==============================================================================
+// Generate code to substitute the symmetric input values
+//
+// Generates the code to replace the elements x[i], i>n/2, by the conjugate
+// complex values of x[n-i] as required for symmIn if no binary inversion
+// algorithm takes care of it. Flag bitRevOrder denotes the input sequence to be
+// in bit reversed order, so x[i] is to be found at index bitRev(i).
+//
+
+static void  genSymmIn (
+    const int  bitRevOrder    // Flag: !=0: Input sequence in bit reversed order
+) {
+    const int  n = gen.n;
+    int  i, p, q, b;
+
+    for (i=n/2+1; i<n; ++i) {
+        p = i;
+        q = n - i;
+        if (bitRevOrder) {
+            p = bitRev (p, n);
+            q = bitRev (q, n);
+        }
+        for (b=0; genBlock(b); ++b) {
+            genOut (INDENT"%s =  %s;\n", elem("xr",p), elem("xr",q));
+            if ( ! gen.realIn) {
+                genOut (INDENT"%s = -%s;\n", elem("xi",p), elem("xi",q));
+            }
+        }
+    }
+}
+
+
+
+//==============================================================================
+// Generate code for the multiplication of a complex value by a twiddle factor
+//
+// Generates the code for
+//   tr = wr*xr - wi*xi;
+//   ti = wr*xi + wi*xr;
+// tr, ti, xr, and xi being the names of the destination and source variables
+// passed as arguments, e.g. "xr[5]" for a sequence element. Multiplications by
+// zero and one are removed as well as summands with a source value known to be
+// zero. If an expression turns out to be zero then no code is written for it
+// and the according flag *trz or *tiz is set.
+// If neither part of the twiddle factor is zero and both source values may be
+// non-zero then option -u selects the form of the multiplication, with the
+// constants derived from wr and wi computed here:
+//   fma:    tr = fma(wr, xr, -wi*xi);
+//           ti = fma(wr, xi, wi*xr);
+//   3mul:   tk = wr*(xr + xi);
+//           tr = tk - (wr+wi)*xi;
+//           ti = tk + (wi-wr)*xr;
+//   ratio:  tr = wr*(xr - (wi/wr)*xi);
+//           ti = wr*(xi + (wi/wr)*xr);
+// The ratio form is factored by wi instead if |wi| > |wr|, so the ratio doesn't
+// exceed one, see genScaledSum(). The 3mul form needs the additional temporary
+// tk. Without the imaginary part it falls back to the plain form.
+//
+
+static void  genTwiddle (
+    const char   *tr,         // Name of the destination real part
+    const char   *ti,         // Name of the destination imaginary part
+    const char   *xr,         // Name of the source real part
+    const int     xrz,        // Flag: !=0: xr is zero
+    const char   *xi,         // Name of the source imaginary part
+    const int     xiz,        // Flag: !=0: xi is zero
+    const double  wr,         // Real part of the twiddle factor
+    const double  wi,         // Imaginary part of the twiddle factor
+    const int     noImag,     // Flag: !=0: Don't implement the imaginary part
+          int    *trz,        // Returned flag: Expression for tr is zero
+          int    *tiz         // Returned flag: Expression for ti is zero
+) {
+    static char  line[LINELEN];
+
+    *trz = 0;
+    *tiz = 0;
+
+    if (   gen.cmul != CMUL_PLAIN  &&  fabs(wr) > gen.eps  &&  fabs(wi) > gen.eps
+        && ! xrz  &&  ! xiz) {
+        if (gen.cmul == CMUL_FMA) {
+            genOut (INDENT"%s = %s (%s, %s, %s*%s);\n", tr, gen.fma, constant(wr), xr,
+                    constant(-wi), xi);
+            if ( ! noImag) {
+                genOut (INDENT"%s = %s (%s, %s, %s*%s);\n", ti, gen.fma, constant(wr),
+                        xi, constant(wi), xr);
+            }
+            return;
+        }
+        if (gen.cmul == CMUL_THREE  &&  ! noImag) {
+            genOut (INDENT"tk = %s*(%s + %s);\n", constant(wr), xr, xi);
+            genScaledSum (tr, 1., "tk", -(wr+wi), xi);
+            genScaledSum (ti, 1., "tk", wi-wr, xr);
+            return;
+        }
+        if (gen.cmul == CMUL_RATIO  &&  fabs(wr) >= fabs(wi)) {
+            genScaledSum (tr, wr, xr, -wi/wr, xi);
+            if ( ! noImag)  genScaledSum (ti, wr, xi, wi/wr, xr);
+            return;
+        }
+        if (gen.cmul == CMUL_RATIO) {
+            genScaledSum (tr, -wi, xi, -wr/wi, xr);
+            if ( ! noImag)  genScaledSum (ti, wi, xr, wr/wi, xi);
+            return;
+        }
+    }
+
+#ifndef OPTIMIZE_SINE_COSINE_VALUES
+    genOut (INDENT"%s = %s*%s - %s*%s;\n", tr, constant(wr), xr, constant(wi), xi);
+    if ( ! noImag) {
+        genOut (INDENT"%s = %s*%s + %s*%s;\n", ti, constant(wr), xi, constant(wi), xr);
+    }
+#else
+    size_t  len;
+                           // Flag: 1st summand of
+                           //   tr = wr*xr - wi*xi;
+                           // or
+                           //   ti = wr*xi + wi*xr;
+                           // is zero
+    int  firstOpZero;
+
+    //--------------------------------------------------------------------------
+    // Implement tr = wr*xr - wi*xi;
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Part wr*xr
+    firstOpZero = 0;
+
+    snprintf (line, LINELEN, INDENT"%s =", tr);
+    len = strlen (line);
+
+    if (fabs(wr) > gen.eps  &&  ! xrz) {
+        // wr != 0  and  xr non-zero
+        if (wr < gen.epsOne) {
+            // wr != 1
+            if (wr > gen.epsMOne) {
+                // wr != -1
+                snprintf (line+len,LINELEN-len," %s*%s", constant(wr), xr);
+            } else {
+                // wr == -1
+                snprintf (line+len,LINELEN-len," -%s", xr);
+            }
+        } else {
+            // wr == 1
+            snprintf (line+len,LINELEN-len," %s", xr);
+        }
+    } else {
+        firstOpZero = 1;
+    }
+    len = strlen (line);
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Part -wi*xi
+
+    if (fabs(wi) > gen.eps  &&  ! xiz) {
+        // wi != 0  and  xi non-zero
+        if (wi < gen.epsOne) {
+            // wi != 1
+            if (wi > gen.epsMOne) {
+                // wi != -1
+                if ( ! firstOpZero) {       // If wr*xr != 0
+                    if (wi >= 0.0) {
+                        snprintf (line+len,LINELEN-len," - %s*%s", constant(wi), xi);
+                    } else {
+                        snprintf (line+len,LINELEN-len," + %s*%s", constant(-wi), xi);
+                    }
+                } else {
+                    snprintf (line+len,LINELEN-len," %s*%s", constant(-wi), xi);
+                }
+            } else {
+                // wi == -1
+                if ( ! firstOpZero) {
+                    snprintf (line+len,LINELEN-len," + %s", xi);
+                } else {
+                    snprintf (line+len,LINELEN-len," %s", xi);
+                }
+            }
+        } else {
+            // wi == 1
+            snprintf (line+len,LINELEN-len," - %s", xi);
+        }
+        fputs (line, gen.out);
+        fputs (";\n", gen.out);
+    } else {
+        // wi == 0  or  xi == 0
+        if ( ! firstOpZero) {
+            fputs (line, gen.out);
+            fputs (";\n", gen.out);
+        } else {
+            *trz = 1;   // tr = wr*xr-wi*xi == 0
+            // Expression for tr is zero, so don't write anything
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Implement ti = wr*xi + wi*xr;
+
+    if ( ! noImag) {
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // Part wr*xi
+
+        firstOpZero = 0;
+        snprintf (line, LINELEN, INDENT"%s =", ti);
+        len = strlen (line);
+
+        if (fabs(wr) > gen.eps  &&  ! xiz) {
+            // wr != 0  and  xi non-zero
+            if (wr < gen.epsOne) {
+                // wr != 1
+                if (wr > gen.epsMOne) {
+                    // wr != -1
+                    snprintf (line+len,LINELEN-len," %s*%s", constant(wr), xi);
+                } else {
+                    // wr == -1
+                    snprintf (line+len,LINELEN-len," -%s", xi);
+                }
+            } else {
+                // wr == 1
+                snprintf (line+len,LINELEN-len," %s", xi);
+            }
+        } else {
+            firstOpZero = 1;
+        }
+        len = strlen (line);
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // Part +wi*xr
+
+        if (fabs(wi) > gen.eps  &&  ! xrz) {
+            // wi != 0  and  xr non-zero
+            if (wi < gen.epsOne) {
+                // wi != 1
+                if (wi > gen.epsMOne) {
+                    // wi != -1
+                    if ( ! firstOpZero) {       // If wr*xi != 0
+                        if (wi >= 0.0) {
+                            snprintf (line+len,LINELEN-len," + %s*%s", constant(wi), xr);
+                        } else {
+                            snprintf (line+len,LINELEN-len," - %s*%s", constant(-wi), xr);
+                        }
+                    } else {
+                        snprintf (line+len,LINELEN-len," %s*%s", constant(wi), xr);
+                    }
+                } else {
+                    // wi == -1
+                    snprintf (line+len,LINELEN-len," - %s", xr);
+                }
+            } else {
+                // wi == 1
+                if ( ! firstOpZero) {
+                    snprintf (line+len,LINELEN-len," + %s", xr);
+                } else {
+                    snprintf (line+len,LINELEN-len," %s", xr);
+                }
+            }
+            fputs (line, gen.out);
+            fputs (";\n", gen.out);
+        } else {
+            // wi == 0  or  xr == 0
+            if ( ! firstOpZero) {      // If wr*xi != 0
+                fputs (line, gen.out);
+                fputs (";\n", gen.out);
+            } else {
+                *tiz = 1;   // ti = wr*xi+wi*xr == 0
+                // Expression for ti is zero, so don't write anything
+            }
+        }
+    }
+#endif
+}
+
+
+
+//==============================================================================
+// Generate code for a scaled sum
+//
+// Generates the code for
+//   d = f*(a + c*b);
+// d, a, and b being the names of the destination and source variables. For f
+// equal to one the factor and the parentheses are omitted. A negative c is
+// written as subtraction, and a c of magnitude one or zero as addition or
+// subtraction of b, or no summand at all, see genTwiddle().
+//
+
+static void  genScaledSum (
+    const char   *d,          // Name of the destination
+    const double  f,          // Factor of the sum
+    const char   *a,          // Name of the first summand
+    const double  c,          // Factor of the second summand
+    const char   *b           // Name of the second summand
+) {
+    char  sum[LINELEN];
+
+    if (fabs(c) < gen.eps) {
+        snprintf (sum, LINELEN, "%s", a);
+    } else if (fabs (fabs(c) - 1.) < 1. - gen.epsOne) {
+        snprintf (sum, LINELEN, "%s %c %s", a, c < 0. ? '-' : '+', b);
+    } else {
+        snprintf (sum, LINELEN, "%s %c %s*%s", a, c < 0. ? '-' : '+',
+                  constant(fabs(c)), b);
+    }
+    if (f == 1.)  genOut (INDENT"%s = %s;\n", d, sum);
+    else          genOut (INDENT"%s = %s*(%s);\n", d, constant(f), sum);
+}
+
+
+
+//==============================================================================
+// Generate code for a radix-2 butterfly
+//
+// Generates the code for
+//   xr[jj] = xr[ii] - tr;
+//   xi[jj] = xi[ii] - ti;
+//   xr[ii] += tr;
+//   xi[ii] += ti;
+// tr and ti being the names of the temporaries passed as arguments. Their
+// values must have been computed before, see genTwiddle().
+// Flag last denotes the butterfly to write the final result of the transform
+// to xr[jj] and xr[ii].
+//
+
+static void  genButterfly (
+    const int    ii,          // Index of the upper sequence element
+    const int    jj,          // Index of the lower sequence element
+    const char  *tr,          // Name of the temporary for the real part
+    const char  *ti,          // Name of the temporary for the imaginary part
+    const int    trz,         // Flag: !=0: tr is zero
+    const int    tiz,         // Flag: !=0: ti is zero
+    const int    last,        // Flag: !=0: Butterfly of the last stage
+    const int    noImag       // Flag: !=0: Don't implement the imaginary part
+) {
+    int  *const  nzi = gen.nzi;
+
+    if ( ! (gen.symmOut && last && jj>gen.n/2)) {
+        //----------------------------------------------------------------------
+        // Implement xr[jj] = xr[ii] - tr;
+
+        if ( ! trz) {
+            genOut (INDENT"%s = %s - %s;\n", elem("xr",jj), elem("xr",ii), tr);
+        } else {
+            genOut (INDENT"%s = %s;\n", elem("xr",jj), elem("xr",ii));
+        }
+
+        //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+        // Implement xi[jj] = xi[ii] - ti;
+
+        if ( ! noImag) {
+            if ( ! tiz) {
+                if (nzi[ii]) {
+                    genOut (INDENT"%s = %s - %s;\n", elem("xi",jj), elem("xi",ii), ti);
+                } else {
+                    genOut (INDENT"%s = - %s;\n", elem("xi",jj), ti);
+                }
+                nzi[jj] = 1;
+            } else {
+                if (nzi[ii]) {
+                    genOut (INDENT"%s = %s;\n", elem("xi",jj), elem("xi",ii));
+                    nzi[jj] = 1;
+                } else {
+                    nzi[jj] = 0;
+                    if (gen.realIn && last) {
+                        // In case of realIn this element has not yet
+                        // been touched. So it must be set zero here
+                        // because imaginary input values at realIn
+                        // could be arbitrary but should contain valid
+                        // values at output
+                        genOut (INDENT"%s = 0.0;\n", elem("xi",jj));
+                    }
+                }
+            }
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Implement xr[ii] += tr;
+
+    if ( ! trz) {
+        genOut (INDENT"%s += %s;\n", elem("xr",ii), tr);
+    }
+
+    //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+    // Implement xi[ii] += ti;
+
+    if ( ! noImag) {
+        if ( ! tiz) {
+            if (nzi[ii]) {
+                genOut (INDENT"%s += %s;\n", elem("xi",ii), ti);
+            } else {
+                genOut (INDENT"%s = %s;\n", elem("xi",ii), ti);
+                nzi[ii] = 1;
+            }
+        } else if (gen.realIn && last) {
+            // In case of realIn this element has not yet been
+            // touched. So it must be set zero here because
+            // imaginary input values at realIn could be arbitrary
+            // but should contain valid values at output
+            genOut (INDENT"%s = 0.0;\n", elem("xi",ii));
+        }
+    }
+}
+
+
+
+//==============================================================================
+// Generate code for a radix-4 butterfly
+//
+// The radix-4 butterfly combines the two radix-2 stages with distance k and 2k
+// operating on the sequence elements with indices i0, i1=i0+k, i2=i0+2k and
+// i3=i0+3k. With the twiddle factor w=exp(i*a) it computes
+//   A0 = x[i0] + w^2*x[i1]
+//   A1 = x[i0] - w^2*x[i1]
+// in place of x[i0] and x[i1] and then the L-shaped butterfly, see
+// genLButterfly(). This requires three complex multiplications instead of four
+// of the two radix-2 stages.
+//
+
+static void  genRadix4 (
+    const int     i0,         // Index of the first sequence element
+    const int     k,          // Distance of the sequence elements
+    const double  a,          // Angle of the twiddle factor w=exp(i*a)
+    const int     last        // Flag: !=0: Butterfly of the last stage
+) {
+    const int  noImag = gen.realOut && last;
+
+    int  trz, tiz;              // Flags: tr, ti is zero
+
+    genTwiddle ("tr", "ti", elem("xr",i0+k), 0, elem("xi",i0+k),
+                ! gen.nzi[i0+k], cos(2.*a), sin(2.*a), noImag, &trz, &tiz);
+    genButterfly (i0, i0+k, "tr", "ti", trz, tiz, 0, noImag);
+
+    genLButterfly (i0, k, a, last, noImag);
+}
+
+
+
+//==============================================================================
+// Generate code for an L-shaped butterfly
+//
+// The L-shaped butterfly operates on the sequence elements with indices i0,
+// i1=i0+k, i2=i0+2k and i3=i0+3k. With the twiddle factor w=exp(i*a) it
+// computes
+//   B0 = w*x[i2] + w^3*x[i3]
+//   B1 = w*x[i2] - w^3*x[i3]
+//   x[i0] = x[i0] + B0            x[i1] = x[i1] -/+ i*B1
+//   x[i2] = x[i0] - B0            x[i3] = x[i1] +/- i*B1
+// the upper sign for the standard, the lower one for the inverse FFT. It is
+// the second half of a radix-4 butterfly and the combining step of the
+// split-radix algorithm.
+// In addition to tr and ti the generated code requires the temporaries ur, ui,
+// vr, and vi.
+//
+
+static void  genLButterfly (
+    const int     i0,         // Index of the first sequence element
+    const int     k,          // Distance of the sequence elements
+    const double  a,          // Angle of the twiddle factor w=exp(i*a)
+    const int     last,       // Flag: !=0: Butterfly of the last stage
+    const int     noImag      // Flag: !=0: Don't implement x[i0..i3] imag.
+) {
+    const int  i1 = i0 + k;
+    const int  i2 = i0 + 2*k;
+    const int  i3 = i0 + 3*k;
+
+    int  trz, tiz;              // Flags: tr, ti is zero
+    int  urz, uiz;              // Flags: ur, ui is zero
+    int  vrz, viz;              // Flags: vr, vi is zero
+
+    //--------------------------------------------------------------------------
+    // Implement u = w*x[i2] and v = w^3*x[i3]
+
+    genTwiddle ("ur", "ui", elem("xr",i2), 0, elem("xi",i2), ! gen.nzi[i2],
+                cos(a), sin(a), 0, &urz, &uiz);
+    genTwiddle ("vr", "vi", elem("xr",i3), 0, elem("xi",i3), ! gen.nzi[i3],
+                cos(3.*a), sin(3.*a), 0, &vrz, &viz);
+
+    //--------------------------------------------------------------------------
+    // Implement B0 = u + v, x[i2] = x[i0] - B0, x[i0] = x[i0] + B0
+
+    trz = genSum ("tr", "ur", urz, '+', "vr", vrz);
+    tiz = noImag || genSum ("ti", "ui", uiz, '+', "vi", viz);
+    genButterfly (i0, i2, "tr", "ti", trz, tiz, last, noImag);
+
+    //--------------------------------------------------------------------------
+    // Implement t = -/+i*B1, x[i3] = x[i1] - t, x[i1] = x[i1] + t
+
+    if ( ! gen.inv) {
+        // t = -i*(u-v) = (ui-vi) - i*(ur-vr)
+        trz = genSum ("tr", "ui", uiz, '-', "vi", viz);
+        tiz = noImag || genSum ("ti", "vr", vrz, '-', "ur", urz);
+    } else {
+        // t = i*(u-v) = (vi-ui) + i*(ur-vr)
+        trz = genSum ("tr", "vi", viz, '-', "ui", uiz);
+        tiz = noImag || genSum ("ti", "ur", urz, '-', "vr", vrz);
+    }
+    genButterfly (i1, i3, "tr", "ti", trz, tiz, last, noImag);
+}
+
+
+
+//==============================================================================
+// Generate code for a split-radix transform
+//
+// Generates the code for the in place transform of the len elements starting at
+// index base, which must already be in bit reversed order. The first half of
+// these elements is transformed with half the length, the quarters three and
+// four with a quarter of the length, each recursively by this function. Their
+// results are then combined by L-shaped butterflies, see genLButterfly().
+// Flag noImag is passed on to the transform of the first half only because the
+// imaginary values of its results contribute to imaginary output values only.
+//
+
+static void  genSplitRadix (
+    const int  base,          // Index of the first sequence element
+    const int  len,           // Number of sequence elements to be transformed
+    const int  noImag         // Flag: !=0: Don't implement output imag. values
+) {
+    const int  last = len == gen.n;
+    int  m, b;
+
+    if (len == 2) {
+        int  trz, tiz;              // Flags: tr, ti is zero
+
+        for (b=0; genBlock(b); ++b) {
+            genTwiddle ("tr", "ti", elem("xr",base+1), 0, elem("xi",base+1),
+                        ! gen.nzi[base+1], 1.0, 0.0, noImag, &trz, &tiz);
+            genButterfly (base, base+1, "tr", "ti", trz, tiz, last, noImag);
+        }
+    } else if (len > 2) {
+        genSplitRadix (base, len/2, noImag);
+        genSplitRadix (base+len/2, len/4, 0);
+        genSplitRadix (base+3*len/4, len/4, 0);
+
+        for (m=0; m<len/4; ++m) {
+            double  a = 2.*M_PI*(-m)/len;
+            if (gen.inv)  a = -a;       // Prepare inverse FFT
+            for (b=0; genBlock(b); ++b) {
+                genLButterfly (base+m, len/4, a, last, noImag);
+            }
+        }
+    }
+}
+
+
+
+//==============================================================================
+// Generate code for a decimation in frequency radix-2 butterfly
+//
+// Generates the code for
+//   tr = xr[ii] - xr[jj];
+//   ti = xi[ii] - xi[jj];
+//   xr[ii] += xr[jj];
+//   xi[ii] += xi[jj];
+//   xr[jj] = wr*tr - wi*ti;
+//   xi[jj] = wr*ti + wi*tr;
+// Operands known to be zero are omitted, see gen.nzr and gen.nzi. If x[jj] is
+// zero then x[ii] is multiplied by the twiddle factor directly. Flag last
+// denotes the butterfly to write the final result of the transform, which then
+// is still in bit reversed order. Elements found to be zero in the final result
+// are set zero explicitly because they may still contain input values.
+//
+
+static void  genDifButterfly (
+    const int     ii,         // Index of the upper sequence element
+    const int     jj,         // Index of the lower sequence element
+    const double  wr,         // Real part of the twiddle factor
+    const double  wi,         // Imaginary part of the twiddle factor
+    const int     last        // Flag: !=0: Butterfly of the last stage
+) {
+    int  *const  nzr = gen.nzr;
+    int  *const  nzi = gen.nzi;
+
+    const int  noImag = gen.realOut && last;
+                              // Flags: x[ii], x[jj] is required at output
+    const int  needI = ! (gen.symmOut && last && bitRev(ii,gen.n) > gen.n/2);
+    const int  needJ = ! (gen.symmOut && last && bitRev(jj,gen.n) > gen.n/2);
+
+    int  trz, tiz;              // Flags: tr, ti is zero
+    int  rz, iz;                // Flags: Result is zero
+    char  tr[32] = "tr";        // Names of t
+    char  ti[32] = "ti";
+
+    //--------------------------------------------------------------------------
+    // Implement t = x[ii] - x[jj]
+
+    if (needJ  &&  ! nzr[jj]  &&  ! nzi[jj]) {
+        // t = x[ii], use it directly
+        snprintf (tr, sizeof(tr), "%s", elem("xr",ii));
+        snprintf (ti, sizeof(ti), "%s", elem("xi",ii));
+        trz = ! nzr[ii];
+        tiz = noImag || ! nzi[ii];
+    } else if (needJ) {
+        trz = genSum ("tr", elem("xr",ii), ! nzr[ii], '-', elem("xr",jj), ! nzr[jj]);
+        tiz = noImag
+              || genSum ("ti", elem("xi",ii), ! nzi[ii], '-', elem("xi",jj), ! nzi[jj]);
+    }
+
+    //--------------------------------------------------------------------------
+    // Implement x[ii] += x[jj]
+
+    if (needI) {
+        rz = genSum (elem("xr",ii), elem("xr",ii), ! nzr[ii], '+',
+                     elem("xr",jj), ! nzr[jj]);
+        if (rz && last)  genOut (INDENT"%s = 0.0;\n", elem("xr",ii));
+        nzr[ii] = ! rz;
+        if ( ! noImag) {
+            iz = genSum (elem("xi",ii), elem("xi",ii), ! nzi[ii], '+',
+                         elem("xi",jj), ! nzi[jj]);
+            if (iz && last)  genOut (INDENT"%s = 0.0;\n", elem("xi",ii));
+            nzi[ii] = ! iz;
+        }
+    }
+
+    //--------------------------------------------------------------------------
+    // Implement x[jj] = w*t
+
+    if (needJ) {
+        genTwiddle (elem("xr",jj), elem("xi",jj), tr, trz, ti, tiz,
+                    wr, wi, noImag, &rz, &iz);
+        if (rz && last)  genOut (INDENT"%s = 0.0;\n", elem("xr",jj));
+        nzr[jj] = ! rz;
+        if ( ! noImag) {
+            if (iz && last)  genOut (INDENT"%s = 0.0;\n", elem("xi",jj));
+            nzi[jj] = ! iz;
+        }
+    }
+}
+
+
+
+//==============================================================================
+// Generate code for the Stockham autosort algorithm
+//
+// Generates the code for an out of place transform reading the input sequence
+// from arrays xr_in and xi_in. In stage s=0,1,... with the sub-transform length
+// l=n/2^s and the stride t=2^s it computes for p=0...l/2-1 and q=0...t-1 with
+// the twiddle factor w=exp(-2*pi*i*p/l)
+//   y[q+t*2p]     =  x[q+t*p] + x[q+t*(p+l/2)]
+//   y[q+t*(2p+1)] = (x[q+t*p] - x[q+t*(p+l/2)]) * w
+// the stages alternately writing to arrays xr/xi and yr/yi such that the last
+// one writes the result to xr/xi in natural order. Hence no bit reversal is
+// required and all accesses of a stage have unit stride in q.
+//
+
+static void  genStockham (void)
+{
+    const int  n = gen.n;
+
+    const char  *srcR = "xr_in";    // Source and destination arrays
+    const char  *srcI = "xi_in";
+    const char  *dstR, *dstI;
+    int  *nzr = gen.nzr;            // Flags: Source element non-zero
+    int  *nzi = gen.nzi;
+    int  *dzr, *dzi;                // Flags: Destination element non-zero
+    int  *tmp;
+    int  nStages, stage, len, t, p, q;
+
+    if (n == 1) {
+        genOut (INDENT"%s = %s;\n", elem("xr",0), elem("xr_in",0));
+        if (gen.realIn)  genOut (INDENT"%s = 0.0;\n", elem("xi",0));
+        else             genOut (INDENT"%s = %s;\n", elem("xi",0), elem("xi_in",0));
+        return;
+    }
+
+    dzr = (int*)malloc (sizeof(int)*n);
+    dzi = (int*)malloc (sizeof(int)*n);
+    if (dzr == NULL  ||  dzi == NULL) {
+        fprintf (stderr, "\n"LOGO": Error allocating memory: %s\n", strerror(errno));
+        exit (EXIT_FAILURE);
+    }
+
+    for (nStages=0,len=n; len>1; len/=2)  ++nStages;
+
+    for (stage=0,len=n,t=1; len>1; ++stage,len/=2,t*=2) {
+        const int  last = len == 2;
+        const int  noImag = gen.realOut && last;
+
+        // Let the last stage write to xr/xi
+        if ((nStages-1-stage) % 2 == 0) {
+            dstR = "xr";
+            dstI = "xi";
+        } else {
+            dstR = "yr";
+            dstI = "yi";
+        }
+
+        for (p=0; p<len/2; ++p) {
+            double  a  = 2.*M_PI*(-p)/len;
+            double  wr = cos (a);
+            double  wi = sin (a);
+            if (gen.inv)  wi = -wi;     // Prepare inverse FFT
+
+            for (q=0; q<t; ++q) {
+                const int  io0 = q + t*2*p;     // Destination indices
+                const int  io1 = io0 + t;
+                int  ia = q + t*p;              // Source indices
+                int  ib = ia + t*len/2;
+                int  conjB = 0;     // Flag: Use the conjugate complex of x[ib]
+                                    // Operators for the imaginary parts of
+                char  opP = '+';    //   x[ia] + x[ib]
+                char  opM = '-';    //   x[ia] - x[ib]
+                                    // Flags: x[io0], x[io1] required at output
+                const int  need0 = ! (gen.symmOut && last && io0 > n/2);
+                const int  need1 = ! (gen.symmOut && last && io1 > n/2);
+                int  trz, tiz;      // Flags: tr, ti is zero
+                int  rz, iz;        // Flags: Result is zero
+
+                if (stage == 0  &&  gen.symmIn  &&  ib > n/2) {
+                    // Use the symmetry relationship x[ib]=x*[n-ib]
+                    ib = n - ib;
+                    conjB = 1;
+                    opP = '-';
+                    opM = '+';
+                }
+
+                //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                // Implement y[io0] = x[ia] + x[ib]
+
+                dzr[io0] = dzi[io0] = 0;
+                if (need0) {
+                    rz = genSum (elem(dstR,io0), elem(srcR,ia), ! nzr[ia], '+',
+                                 elem(srcR,ib), ! nzr[ib]);
+                    if (rz && last)  genOut (INDENT"%s = 0.0;\n", elem(dstR,io0));
+                    dzr[io0] = ! rz;
+                    if ( ! noImag) {
+                        iz = genSum (elem(dstI,io0), elem(srcI,ia), ! nzi[ia], opP,
+                                     elem(srcI,ib), ! nzi[ib]);
+                        if (iz && last)  genOut (INDENT"%s = 0.0;\n", elem(dstI,io0));
+                        dzi[io0] = ! iz;
+                    }
+                }
+
+                //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+                // Implement y[io1] = (x[ia] - x[ib]) * w
+
+                dzr[io1] = dzi[io1] = 0;
+                if ( ! need1)  continue;
+
+                if (p == 0) {
+                    // w == 1
+                    rz = genSum (elem(dstR,io1), elem(srcR,ia), ! nzr[ia], '-',
+                                 elem(srcR,ib), ! nzr[ib]);
+                    iz = noImag
+                         || genSum (elem(dstI,io1), elem(srcI,ia), ! nzi[ia], opM,
+                                    elem(srcI,ib), ! nzi[ib]);
+                } else if (4*p == len  &&  ! conjB) {
+                    // w == -i, or w == i for the inverse FFT
+                    if ( ! gen.inv) {
+                        rz = genSum (elem(dstR,io1), elem(srcI,ia), ! nzi[ia], '-',
+                                     elem(srcI,ib), ! nzi[ib]);
+                        iz = noImag
+                             || genSum (elem(dstI,io1), elem(srcR,ib), ! nzr[ib], '-',
+                                        elem(srcR,ia), ! nzr[ia]);
+                    } else {
+                        rz = genSum (elem(dstR,io1), elem(srcI,ib), ! nzi[ib], '-',
+                                     elem(srcI,ia), ! nzi[ia]);
+                        iz = noImag
+                             || genSum (elem(dstI,io1), elem(srcR,ia), ! nzr[ia], '-',
+                                        elem(srcR,ib), ! nzr[ib]);
+                    }
+                } else {
+                    trz = genSum ("tr", elem(srcR,ia), ! nzr[ia], '-',
+                                  elem(srcR,ib), ! nzr[ib]);
+                    tiz = genSum ("ti", elem(srcI,ia), ! nzi[ia], opM,
+                                  elem(srcI,ib), ! nzi[ib]);
+                    genTwiddle (elem(dstR,io1), elem(dstI,io1), "tr", trz,
+                                "ti", tiz, wr, wi, noImag, &rz, &iz);
+                }
+                if (rz && last)  genOut (INDENT"%s = 0.0;\n", elem(dstR,io1));
+                dzr[io1] = ! rz;
+                if ( ! noImag) {
+                    if (iz && last)  genOut (INDENT"%s = 0.0;\n", elem(dstI,io1));
+                    dzi[io1] = ! iz;
+                }
+            }
+        }
+
+        // The destination of this stage is the source of the next one
+        srcR = dstR;
+        srcI = dstI;
+        tmp = nzr;  nzr = dzr;  dzr = tmp;
+        tmp = nzi;  nzi = dzi;  dzi = tmp;
+    }
+
+    // Return the arrays not owned by gen, they may have been swapped
+    if (dzr == gen.nzr) {
+        free (nzr);
+    } else {
+        free (dzr);
+    }
+    if (dzi == gen.nzi) {
+        free (nzi);
+    } else {
+        free (dzi);
+    }
+}
+
+
+
+//==============================================================================
+// Generate code for a radix-2 stage on vectors
+//
+// Generates the code of a decimation in time radix-2 stage with the distance k
+// of the butterflies operating on vectors of gen.lanes elements. The butterflies
+// of gen.lanes adjacent twiddle factors m...m+gen.lanes-1 access adjacent
+// elements, they are computed together by one vector operation. Their twiddle
+// factors are packed into the vectors wr and wi. This requires k>=gen.lanes,
+// the stages of a shorter distance are generated by genSimdRegStages(). The
+// complex multiplication uses fused multiply-add if available, see vFma().
+// The vectors are accessed by unaligned loads and stores, which are as fast as
+// aligned ones on current processors if the address is aligned.
+//
+
+static void  genSimdStage (
+    const int  k              // Distance of the butterflies
+) {
+    const int  n = gen.n;
+    double  wr[16], wi[16];   // Twiddle factors of the lanes
+    int  m, l, ii, jj;
+
+    for (m=0; m<k; m+=gen.lanes) {
+        for (l=0; l<gen.lanes; ++l) {
+            const double  a = M_PI*(-(m+l))/k;
+            wr[l] = cos (a);
+            wi[l] = gen.inv ? -sin (a) : sin (a);
+        }
+        genOut (INDENT"wr = %s;\n", vSet (wr));
+        genOut (INDENT"wi = %s;\n", vSet (wi));
+
+        for (ii=m; ii<n; ii+=2*k) {
+            jj = ii + k;
+            genOut (INDENT"ar = %s;\n", vLoad (elem("xr",jj)));
+            genOut (INDENT"ai = %s;\n", vLoad (elem("xi",jj)));
+            genOut (INDENT"cr = %s;\n", vFma ("fmsub", "wr", "ar",
+                                               vOp ("mul", "wi", "ai")));
+            genOut (INDENT"ci = %s;\n", vFma ("fmadd", "wr", "ai",
+                                               vOp ("mul", "wi", "ar")));
+            genOut (INDENT"ar = %s;\n", vLoad (elem("xr",ii)));
+            genOut (INDENT"ai = %s;\n", vLoad (elem("xi",ii)));
+            vStore (elem("xr",jj), vOp ("sub", "ar", "cr"));
+            vStore (elem("xi",jj), vOp ("sub", "ai", "ci"));
+            vStore (elem("xr",ii), vOp ("add", "ar", "cr"));
+            vStore (elem("xi",ii), vOp ("add", "ai", "ci"));
+        }
+    }
+}
+
+
+
+//==============================================================================
+// Generate the code of the radix-2 stages within the vector registers
+//
+// Generates the code of the decimation in time radix-2 stages with the
+// distances k=1, 2, ..., gen.lanes/2 of the butterflies, whose butterflies
+// don't leave a vector of gen.lanes adjacent elements. So each vector is loaded
+// once, all these stages are done in the registers, and the vector is stored
+// once. In each stage the operands of the butterflies are distributed to all
+// lanes by shuffles, see vShuffle(): The vectors cr and ci get the elements of
+// the upper, the vectors ar and ai those of the lower halves of the groups of
+// 2k lanes. The lane l gets the result cr+w*ar with the twiddle factor w of the
+// butterfly, negated in the lower halves, computed by fused multiply-adds if
+// available, see vFma(). The roles of the vectors swap from stage to stage.
+//
+
+static void  genSimdRegStages (void)
+{
+    const int  n = gen.n;
+    const char *const  vr[2] = {"ar", "cr"};    // Alternating vectors
+    const char *const  vi[2] = {"ai", "ci"};
+    double  wr[16], wi[16];   // Twiddle factors of the lanes
+    int  i, j, k, l, s, wiz;
+
+    for (i=0; i<n; i+=gen.lanes) {
+        genOut (INDENT"ar = %s;\n", vLoad (elem("xr",i)));
+        genOut (INDENT"ai = %s;\n", vLoad (elem("xi",i)));
+
+        for (s=j=0,k=1; k<gen.lanes; ++j,k*=2,s=1-s) {
+            const char *const  ar = vr[s],   *const  ai = vi[s];
+            const char *const  cr = vr[1-s], *const  ci = vi[1-s];
+
+            wiz = 1;
+            for (l=0; l<gen.lanes; ++l) {
+                const double  a = M_PI*(-(l%k))/k;
+                const double  sign = l & k ? -1. : 1.;
+                wr[l] = sign*cos (a);
+                wi[l] = sign*(gen.inv ? -sin (a) : sin (a));
+                if (fabs (wi[l]) >= gen.eps)  wiz = 0;
+            }
+            genOut (INDENT"wr = %s;\n", vSet (wr));
+            if ( ! wiz)  genOut (INDENT"wi = %s;\n", vSet (wi));
+
+            genOut (INDENT"%s = %s;\n", cr, vShuffle (0, j, ar));
+            genOut (INDENT"%s = %s;\n", ci, vShuffle (0, j, ai));
+            genOut (INDENT"%s = %s;\n", ar, vShuffle (1, j, ar));
+            genOut (INDENT"%s = %s;\n", ai, vShuffle (1, j, ai));
+            if (wiz) {
+                genOut (INDENT"%s = %s;\n", cr, vFma ("fmadd", "wr", ar, cr));
+                genOut (INDENT"%s = %s;\n", ci, vFma ("fmadd", "wr", ai, ci));
+            } else {
+                genOut (INDENT"%s = %s;\n", cr, vFma ("fmadd", "wr", ar,
+                                                   vFma ("fnmadd", "wi", ai, cr)));
+                genOut (INDENT"%s = %s;\n", ci, vFma ("fmadd", "wr", ai,
+                                                   vFma ("fmadd", "wi", ar, ci)));
+            }
+        }
+
+        vStore (elem("xr",i), vr[s]);
+        vStore (elem("xi",i), vi[s]);
+    }
+}
+
+
+
+//==============================================================================
+// Generate code for the sum or difference of two values
+//
+// Generates the code for
+//   d = a + b;    or    d = a - b;
+// considering the flags az and bz denoting a or b to be zero. If d and a are the
+// same variable then the code is written as d += b or d -= b. Returns 1 if the
+// result is zero and no code has been written, otherwise 0.
+//
+
+static int  genSum (
+    const char  *d,           // Name of the destination
+    const char  *a,           // Name of the first operand
+    const int    az,          // Flag: !=0: a is zero
+    const char   op,          // Operator '+' or '-'
+    const char  *b,           // Name of the second operand
+    const int    bz           // Flag: !=0: b is zero
+) {
+    if (az && bz)  return 1;
+
+    if ( ! strcmp(d,a)  &&  ! az) {
+        if ( ! bz)  genOut (INDENT"%s %c= %s;\n", d, op, b);
+    } else if (bz) {
+        genOut (INDENT"%s = %s;\n", d, a);
+    } else if (az) {
+        if (op == '+')  genOut (INDENT"%s = %s;\n", d, b);
+        else            genOut (INDENT"%s = - %s;\n", d, b);
+    } else {
+        genOut (INDENT"%s = %s %c %s;\n", d, a, op, b);
+    }
+    return 0;
+}
+
+
+
+//==============================================================================
+// Generate code for a linear combination
+//
+// Implements d = c[0]*s[0] + c[1]*s[1] + ... + c[m-1]*s[m-1]. Summands with a
+// factor being zero are omitted, factors one and minus one are not written,
+// like in genTwiddle(). So the constants of several stages, e.g. a window and
+// a twiddle factor, can be merged into one factor per summand, see genMdct().
+//
+
+static void  genLinComb (
+    const char         *d,    // Name of the destination
+    const int           m,    // Number of summands
+    const double       *c,    // Factors of the summands
+    const char *const  *s     // Names of the operands
+) {
+    char  line[LINELEN];
+    int   j, len, first = 1;
+
+    snprintf (line, LINELEN, INDENT"%s =", d);
+    for (j=0; j<m; ++j) {
+        if (fabs(c[j]) <= gen.eps)  continue;
+
+        len = strlen (line);
+        if (c[j] >= gen.epsOne  ||  c[j] <= gen.epsMOne) {
+            if (first) {
+                snprintf (line+len, LINELEN-len, c[j] > 0.0 ? " %s" : " -%s", s[j]);
+            } else {
+                snprintf (line+len, LINELEN-len, " %c %s", c[j] > 0.0 ? '+' : '-', s[j]);
+            }
+        } else if (first) {
+            snprintf (line+len, LINELEN-len, " %s*%s", constant(c[j]), s[j]);
+        } else {
+            snprintf (line+len, LINELEN-len, " %c %s*%s",
+                      c[j] > 0.0 ? '+' : '-', constant(fabs(c[j])), s[j]);
+        }
+        first = 0;
+    }
+    if (first)  genOut (INDENT"%s = 0.0;\n", d);
+    else        genOut ("%s;\n", line);
+}
+
+
+
+//==============================================================================
+// Iterate over the sequences of a block
+//
+// Used as  for (b=0; genBlock(b); ++b) { ... }  around the code generation of
+// one butterfly or swap, so that it is generated for the gen.block sequences at
+// the offsets gen.offset, gen.offset+1, ... one after the other. Thus adjacent
+// columns of an image are accessed together, see genFft2d(). As each repetition
+// starts from the same state, the flags gen.nzr and gen.nzi are saved at b==0
+// and restored for the following sequences. Returns 0 when all sequences of the
+// block are done, then gen.offset is restored.
+//
+
+static int  genBlock (
+    const int  b              // Index of the sequence in the block
+) {
+    static int  *save;        // Saved flags gen.nzr and gen.nzi
+    static int   size;        // Allocated number of elements in save[]
+    static int   offset;      // Offset of the first sequence of the block
+    int  i;
+
+    if (gen.block <= 1)  return  b == 0;
+
+    if (b == 0) {
+        if (size < 2*gen.n) {
+            save = (int*)realloc (save, sizeof(int)*2*gen.n);
+            if (save == NULL) {
+                fprintf (stderr, "\n"LOGO": Error allocating memory: %s\n",
+                         strerror(errno));
+                exit (EXIT_FAILURE);
+            }
+            size = 2*gen.n;
+        }
+        for (i=0; i<gen.n; ++i) {
+            save[i]       = gen.nzr[i];
+            save[gen.n+i] = gen.nzi[i];
+        }
+        offset = gen.offset;
+    } else if (b < gen.block) {
+        for (i=0; i<gen.n; ++i) {
+            gen.nzr[i] = save[i];
+            gen.nzi[i] = save[gen.n+i];
+        }
+        gen.offset = offset + b;
+    } else {
+        gen.offset = offset;
+        return  0;
+    }
+    return  1;
+}
+
+
+
+//==============================================================================
+// Write generated code
+//
+// Writes the code according to the printf() format fmt to the stream gen.out,
+// which is stdout or, with option -e, the temporary file read by genFunction().
+//
+
+static void  genOut (
+    const char  *fmt,         // printf() format
+    ...                       // Arguments according to fmt
+) {
+    va_list  ap;
+
+    va_start (ap, fmt);
+    vfprintf (gen.out, fmt, ap);
+    va_end (ap);
+}
+
+
+
+//==============================================================================
+// Write the generated code as a complete function
+//
+// Writes the code collected in the temporary file gen.out to stdout as the body
+// of a function with the given name. The arrays are passed as restrict
+// qualified pointers to the given type, so the compiler may assume that they
+// don't overlap, which allows it to reorder and vectorize the code. The
+// temporaries are defined as local variables, only those actually used by the
+// code, so the function compiles without warnings about unused variables. If
+// align is not zero then the arrays are declared to be aligned to that many
+// bytes by __builtin_assume_aligned() as supported by GCC and Clang, its result
+// cast to the type of the array, so the code compiles as C++ as well. With
+// option -x the vector temporaries are of the vector type gen.vtype and the
+// header of the intrinsics is included. If the instruction set is not enabled
+// by default the function gets the according target attribute of GCC and
+// Clang. With the vector extensions the vector type and the one of the
+// alignment of the elements for the loads and stores are defined instead, see
+// vLoad(). Strides given as names of variables by options -I and -O are passed
+// as int parameters after the arrays.
+//
+
+static void  genFunction (
+    const char  *name,        // Name of the function
+    const char  *type,        // Type of the array elements
+    const int    align,       // If !=0: Alignment of the arrays in bytes
+    const int    oneArray,    // Flag: !=0: The code works on the array x[]
+    const int    complexArray,// Flag: !=0: The code works on the array x[]
+                              // being a view of the C99 complex array xc[]
+    const int    outOfPlace,  // Flag: !=0: The code reads xr_in[] and xi_in[]
+    const int    n            // Number of elements of yr[] and yi[]
+) {
+                              // Temporaries the code may use, arrays with size,
+                              // vectors with size -2, see genSimdStage()
+    static const struct {const char *name; int size;}  temps[] = {
+        {"tr",0}, {"ti",0}, {"ur",0}, {"ui",0}, {"vr",0}, {"vi",0}, {"tk",0},
+        {"br",7}, {"bi",7}, {"yr",-1}, {"yi",-1},
+        {"wr",-2}, {"wi",-2}, {"ar",-2}, {"ai",-2}, {"cr",-2}, {"ci",-2}
+    };
+    const int  nTemps = sizeof(temps)/sizeof(temps[0]);
+    static const char *const  oneArrayParams[] = {"x", NULL};
+    static const char *const  complexArrayParams[] = {"xc", NULL};
+    static const char *const  inPlaceParams[] = {"xr", "xi", NULL};
+    static const char *const  outOfPlaceParams[] = {"xr_in", "xi_in", "xr", "xi", NULL};
+    const char *const  *params = oneArray     ? oneArrayParams
+                               : complexArray ? complexArrayParams
+                               : outOfPlace   ? outOfPlaceParams
+                               :                inPlaceParams;
+    FILE *const  body = gen.out;
+    int   used[sizeof(temps)/sizeof(temps[0])] = {0};
+    char  token[8];
+    int   len = 0;
+    int   c, i, first, vfirst;
+
+    //--------------------------------------------------------------------------
+    // Find the temporaries used by the code
+
+    rewind (body);
+    do {
+        c = fgetc (body);
+        if (isalnum (c)  ||  c == '_') {
+            if (len < (int)sizeof(token)-1)  token[len] = (char)c;
+            ++len;
+        } else {
+            if (len > 0  &&  len < (int)sizeof(token)  &&  ! isdigit (token[0])) {
+                token[len] = '\0';
+                for (i=0; i<nTemps; ++i) {
+                    if ( ! strcmp (token, temps[i].name))  used[i] = 1;
+                }
+            }
+            len = 0;
+        }
+    } while (c != EOF);
+
+    //--------------------------------------------------------------------------
+    // Function header and definitions
+
+    if (gen.cmul == CMUL_FMA) {
+        printf ("#include <math.h>\n\n");
+    }
+    if (gen.simd  &&  gen.simd->prefix) {
+        printf ("#include <immintrin.h>\n\n");
+    } else if (gen.simd) {
+        const int  size = strcmp (type, "float") ? 8 : 4;
+        printf ("typedef %s  %s __attribute__ ((vector_size (%d)));\n", type,
+                gen.vtype, gen.simd->bytes);
+        printf ("typedef %s  %s_u __attribute__ ((vector_size (%d), aligned (%d),"
+                " may_alias));\n\n", type, gen.vtype, gen.simd->bytes, size);
+    }
+    if (gen.simd  &&  gen.simd->target) {
+        printf ("__attribute__ ((target (\"%s\")))\n", gen.simd->target);
+    }
+    printf ("void  %s (", name);
+    for (i=0; params[i]; ++i) {
+        printf ("%s%s%s%s *restrict %s", i ? ", " : "",
+                outOfPlace && i < 2 ? "const " : "", type,
+                complexArray ? " _Complex" : "", params[i]);
+    }
+    for (i=0; i<2; ++i) {
+        const char *const  stride = i ? gen.ostride : gen.istride;
+        if (   stride  &&  ! isdigit (stride[0])
+            && ! (i  &&  gen.istride  &&  ! strcmp (gen.istride, stride))) {
+            printf (", const int %s", stride);
+        }
+    }
+    printf (")\n{\n");
+    if (complexArray  &&  align) {
+        printf ("    %s *const  x = (%s *)__builtin_assume_aligned (xc, %d);\n",
+                type, type, align);
+    } else if (complexArray) {
+        printf ("    %s *const  x = (%s *)xc;\n", type, type);
+    }
+    for (first=1,i=0; i<nTemps; ++i) {
+        if ( ! used[i]  ||  temps[i].size == -2)  continue;
+        if (first)  printf ("    %s  %s", type, temps[i].name);
+        else        printf (", %s", temps[i].name);
+        if (temps[i].size)  printf ("[%d]", temps[i].size > 0 ? temps[i].size : n);
+        first = 0;
+    }
+    if ( ! first)  printf (";\n");
+    for (vfirst=1,i=0; i<nTemps; ++i) {
+        if ( ! used[i]  ||  temps[i].size != -2)  continue;
+        if (vfirst)  printf ("    %s  %s", gen.vtype, temps[i].name);
+        else         printf (", %s", temps[i].name);
+        vfirst = first = 0;
+    }
+    if ( ! vfirst)  printf (";\n");
+    if (align  &&  ! complexArray) {
+        if ( ! first)  putchar ('\n');
+        for (i=0; params[i]; ++i) {
+            printf ("    %s = (%s%s *)__builtin_assume_aligned (%s, %d);\n",
+                    params[i], outOfPlace && i < 2 ? "const " : "", type,
+                    params[i], align);
+        }
+    }
+    if ( ! first  ||  align  ||  complexArray)  putchar ('\n');
+    genTable (type, "    ");
+
+    //--------------------------------------------------------------------------
+    // Body, indented, and function end
+
+    genCopy (stdout, "    ");
+    printf ("}\n");
+}
+
+
+
+//==============================================================================
+// Write the table of the constants
+//
+// With option -T the constants of the code are collected by constant() in the
+// table tw[]. This function writes the definition of the table as a static
+// const array of the given type to stdout, each line preceded by indent.
+// Nothing is written if the code doesn't use any constant.
+//
+
+static void  genTable (
+    const char  *type,        // Type of the table elements
+    const char  *indent       // Indentation of the lines
+) {
+    int  i;
+
+    if ( ! gen.table  ||  tw.n == 0)  return;
+
+    printf ("%sstatic const %s  tw[%d] = {", indent, type, tw.n);
+    for (i=0; i<tw.n; ++i) {
+        if (i%3 == 0)  printf ("\n%s   ", indent);
+        printf (" %s%s", tw.val[i], i < tw.n-1 ? "," : "");
+    }
+    printf ("\n%s};\n\n", indent);
+}
+
+
+
+//==============================================================================
+// Copy the generated code
+//
+// Copies the code collected in the temporary file gen.out to the stream to, each
+// non-empty line preceded by indent, closes the temporary file, and continues
+// the output to the stream to.
+//
+
+static void  genCopy (
+    FILE        *to,          // Destination stream
+    const char  *indent       // Indentation of the lines
+) {
+    FILE *const  body = gen.out;
+    int  c, bol;
+
+    rewind (body);
+    for (bol=1; (c = fgetc (body)) != EOF; bol = c == '\n') {
+        if (bol  &&  c != '\n')  fputs (indent, to);
+        fputc (c, to);
+    }
+    fclose (body);
+    gen.out = to;
+}
+
+
+
+//==============================================================================
+// Return the name of a sequence element
+//
+// Returns e.g. "xr[5]" for name "xr" and index 5. If gen.realView is set then
+// the elements of xr and xi are mapped to the one real array x, e.g. "x[10]"
+// and "x[11]" for xr[5] and xi[5]. The indices of the elements of xr and xi
+// are multiplied by gen.stride and increased by gen.offset, so a part of the
+// arrays can be transformed, see genRader(), or e.g. a column of an image, see
+// genFft2d(). If gen.map is set the index is first mapped by gen.map, so an
+// arbitrary subset of the elements can be transformed, see genPrimeFactor().
+// The elements of the input arrays xr_in and xi_in are mapped the same way.
+// Finally the index is multiplied by the stride gen.istride of the input arrays
+// or gen.ostride of xr and xi, if it is the name of a variable in the generated
+// code, e.g. "xr[5*s]". The string is stored in one of several static buffers
+// used in rotation, so it stays valid while the names of the operands of one
+// generated statement are needed.
+//
+
+static const char  *elem (
+    const char  *name,        // Name of the array
+    const int    i            // Index of the element
+) {
+    static char  buf[8][64];    // Rotating buffers
+    static int   ib;
+    const int    in  = ! strcmp(name,"xr_in")  ||  ! strcmp(name,"xi_in");
+    const int    seq = ! strcmp(name,"xr")     ||  ! strcmp(name,"xi")  ||  in;
+    const char  *stride = in ? gen.istride : gen.ostride;
+    int          k = (gen.map ? gen.map[i] : i)*gen.stride + gen.offset;
+
+    if (seq  &&  stride  &&  isdigit (stride[0])) {
+        k *= atoi (stride);
+        stride = NULL;
+    }
+
+    ib = (ib+1) % 8;
+    if (gen.realView  &&  ! strcmp(name,"xr")) {
+        snprintf (buf[ib], sizeof(buf[ib]), "x[%d]", 2*k);
+    } else if (gen.realView  &&  ! strcmp(name,"xi")) {
+        snprintf (buf[ib], sizeof(buf[ib]), "x[%d]", 2*k+1);
+    } else if (gen.base  &&  k == 0  &&  seq) {
+        snprintf (buf[ib], sizeof(buf[ib]), "%s[%s]", name, gen.base);
+    } else if (gen.base  &&  seq) {
+        snprintf (buf[ib], sizeof(buf[ib]), "%s[%s+%d]", name, gen.base, k);
+    } else if (seq  &&  stride  &&  k == 1) {
+        snprintf (buf[ib], sizeof(buf[ib]), "%s[%s]", name, stride);
+    } else if (seq  &&  stride  &&  k != 0) {
+        snprintf (buf[ib], sizeof(buf[ib]), "%s[%d*%s]", name, k, stride);
+    } else if (seq) {
+        snprintf (buf[ib], sizeof(buf[ib]), "%s[%d]", name, k);
+    } else {
+        snprintf (buf[ib], sizeof(buf[ib]), "%s[%d]", name, i);
+    }
+    return  buf[ib];
+}
+
+
+
+//==============================================================================
+// Return the name of the real value i of array x[]
+//
+// Returns e.g. "x[11]" for index 11, which is the imaginary part of sequence
+// element 5, see elem(). Used where the real values are moved or combined
+// independently of the complex elements, see genRealPermutation().
+//
+
+static const char  *realElem (
+    const int  i              // Index of the real value
+) {
+    return  elem (i%2 ? "xi" : "xr", i/2);
+}
+
+
+
+//==============================================================================
+// Return a constant of the code
+//
+// Returns the value c formatted according to NUMBER_FORMAT as literal
+// constant. With option -T the value is instead stored in the table tw[],
+// unless the table already contains it, and the table element is returned,
+// e.g. "tw[5]". Values are regarded as equal if their formatted strings are
+// equal, so a value is stored only once even if it is computed in different
+// ways. The string is stored in one of several static buffers used in rotation,
+// see elem().
+//
+
+static const char  *constant (
+    const double  c           // Value of the constant
+) {
+    static char  buf[8][32];    // Rotating buffers
+    static int   ib;
+    int  k;
+
+    ib = (ib+1) % 8;
+    snprintf (buf[ib], sizeof(buf[ib]), NUMBER_FORMAT, c);
+    if ( ! gen.table)  return  buf[ib];
+
+    for (k=0; k<tw.n  &&  strcmp (tw.val[k], buf[ib]); ++k)  ;
+    if (k == tw.n) {
+        if (tw.n == tw.size) {
+            tw.size = tw.size ? 2*tw.size : 64;
+            tw.val = (char(*)[32])realloc (tw.val, sizeof(tw.val[0])*tw.size);
+            if (tw.val == NULL) {
+                fprintf (stderr, "\n"LOGO": Error allocating memory: %s\n",
+                         strerror(errno));
+                exit (EXIT_FAILURE);
+            }
+        }
+        strcpy (tw.val[tw.n++], buf[ib]);
+    }
+    snprintf (buf[ib], sizeof(buf[ib]), "tw[%d]", k);
+    return  buf[ib];
+}
+
+
+
+//==============================================================================
+// Return the code of a vector operation
+//
+// Returns the intrinsic of the instruction set gen.simd for the operation op,
+// e.g. "_mm_add_pd (a, b)" for "add". With the vector extensions of GCC and
+// Clang the operators are applied to the vectors directly, e.g. "a + b", with
+// parentheses around a subtrahend being a sum. The string is stored in one of
+// several static buffers used in rotation, so the result can be an operand of a
+// further vector operation.
+//
+
+static const char  *vOp (
+    const char  *op,          // Operation, "add", "sub", or "mul"
+    const char  *a,           // First operand
+    const char  *b            // Second operand
+) {
+    static char  buf[8][LINELEN];   // Rotating buffers
+    static int   ib;
+
+    ib = (ib+1) % 8;
+    if (gen.simd->prefix) {
+        snprintf (buf[ib], sizeof(buf[ib]), "%s_%s_%s (%s, %s)",
+                  gen.simd->prefix, op, gen.suffix, a, b);
+    } else if ( ! strcmp (op, "mul")) {
+        snprintf (buf[ib], sizeof(buf[ib]), "%s*%s", a, b);
+    } else if ( ! strcmp (op, "add")) {
+        snprintf (buf[ib], sizeof(buf[ib]), "%s + %s", a, b);
+    } else {
+        snprintf (buf[ib], sizeof(buf[ib]), strpbrk (b, "+-") ? "%s - (%s)"
+                                                               : "%s - %s", a, b);
+    }
+    return  buf[ib];
+}
+
+
+
+//==============================================================================
+// Return the code to load a vector
+//
+// Returns the code to load the gen.lanes adjacent elements starting at the
+// element e, e.g. "_mm_loadu_pd (&xr[4])", with the vector extensions by the
+// vector type of the alignment of the elements, e.g. "*(v4df_u *)&xr[4]". See
+// vOp().
+//
+
+static const char  *vLoad (
+    const char  *e            // Name of the first element
+) {
+    static char  buf[8][LINELEN];   // Rotating buffers
+    static int   ib;
+
+    ib = (ib+1) % 8;
+    if (gen.simd->prefix) {
+        snprintf (buf[ib], sizeof(buf[ib]), "%s_loadu_%s (&%s)",
+                  gen.simd->prefix, gen.suffix, e);
+    } else {
+        snprintf (buf[ib], sizeof(buf[ib]), "*(%s_u *)&%s", gen.vtype, e);
+    }
+    return  buf[ib];
+}
+
+
+
+//==============================================================================
+// Generate code to store a vector
+//
+// Generates the code to store the vector v to the gen.lanes adjacent elements
+// starting at the element e, see vLoad().
+//
+
+static void  vStore (
+    const char  *e,           // Name of the first element
+    const char  *v            // Code of the vector
+) {
+    if (gen.simd->prefix) {
+        genOut (INDENT"%s_storeu_%s (&%s, %s);\n", gen.simd->prefix, gen.suffix,
+                e, v);
+    } else {
+        genOut (INDENT"*(%s_u *)&%s = %s;\n", gen.vtype, e, v);
+    }
+}
+
+
+
+//==============================================================================
+// Return the code of a vector of constants
+//
+// Returns the code of a vector of the gen.lanes values c[0], c[1], ..., e.g.
+// "_mm_setr_pd (c[0], c[1])", with the vector extensions a compound literal,
+// e.g. "(v2df){c[0], c[1]}". Values close to zero or plus or minus one are
+// written exactly, like in the scalar code, see genTwiddle().
+//
+
+static const char  *vSet (
+    const double  *c          // Values of the lanes
+) {
+    static char  buf[2][16*32+32];  // Rotating buffers
+    static int   ib;
+    int  l, len;
+
+    ib = (ib+1) % 2;
+    if (gen.simd->prefix) {
+        len = snprintf (buf[ib], sizeof(buf[ib]), "%s_setr_%s (",
+                        gen.simd->prefix, gen.suffix);
+    } else {
+        len = snprintf (buf[ib], sizeof(buf[ib]), "(%s){", gen.vtype);
+    }
+    for (l=0; l<gen.lanes; ++l) {
+        const double  v = fabs (c[l]) < gen.eps ? 0.
+                        : c[l] > gen.epsOne     ? 1.
+                        : c[l] < gen.epsMOne    ? -1.
+                        :                         c[l];
+        len += snprintf (buf[ib]+len, sizeof(buf[ib])-len, "%s%s",
+                         l ? ", " : "", constant (v));
+    }
+    snprintf (buf[ib]+len, sizeof(buf[ib])-len, gen.simd->prefix ? ")" : "}");
+    return  buf[ib];
+}
+
+
+
+//==============================================================================
+// Return the code of a multiply-add of vectors
+//
+// Returns the code of a*b+c for op "fmadd", a*b-c for "fmsub", and c-a*b for
+// "fnmadd", by the fused multiply-add intrinsics if the instruction set
+// gen.simd provides them, otherwise by a multiplication and an addition or
+// subtraction, see vOp().
+//
+
+static const char  *vFma (
+    const char  *op,          // Operation, "fmadd", "fmsub", or "fnmadd"
+    const char  *a,           // Factors
+    const char  *b,
+    const char  *c            // Summand
+) {
+    static char  buf[8][LINELEN];   // Rotating buffers
+    static int   ib;
+
+    if ( ! gen.simd->fma) {
+        if ( ! strcmp (op, "fnmadd"))  return  vOp ("sub", c, vOp ("mul",a,b));
+        return  vOp (strcmp (op, "fmadd") ? "sub" : "add", vOp ("mul",a,b), c);
+    }
+    ib = (ib+1) % 8;
+    snprintf (buf[ib], sizeof(buf[ib]), "%s_%s_%s (%s, %s, %s)",
+              gen.simd->prefix, op, gen.suffix, a, b, c);
+    return  buf[ib];
+}
+
+
+
+//==============================================================================
+// Return the code of a shuffle of a vector
+//
+// Returns the code of a vector with the lower (hi==0) or upper (hi!=0) halves of
+// the groups of 2*2**j adjacent lanes of the vector v copied to both halves,
+// e.g. "_mm256_unpackhi_pd (v, v)" with the lanes v[1], v[1], v[3], v[3] for
+// j=0. With the vector extensions the lanes are selected by
+// __builtin_shufflevector() of GCC from version 12 on and Clang. See vOp().
+//
+
+static const char  *vShuffle (
+    const int    hi,          // Flag: !=0: Upper halves, else lower halves
+    const int    j,           // Log2 of the size of the halves
+    const char  *v            // Code of the vector
+) {
+    static char  buf[8][LINELEN];   // Rotating buffers
+    static int   ib;
+
+    ib = (ib+1) % 8;
+    if (gen.simd->prefix) {
+        snprintf (buf[ib], sizeof(buf[ib]), gen.shuffle[j][hi], v, v);
+    } else {
+        const int  k = 1 << j;
+        int  l, len;
+
+        len = snprintf (buf[ib], sizeof(buf[ib]), "__builtin_shufflevector (%s, %s",
+                        v, v);
+        for (l=0; l<gen.lanes; ++l) {
+            len += snprintf (buf[ib]+len, sizeof(buf[ib])-len, ", %d",
+                             hi ? l | k : l & ~k);
+        }
+        snprintf (buf[ib]+len, sizeof(buf[ib])-len, ")");
+    }
+    return  buf[ib];
+}
+
+
+
+//==============================================================================
+// Return the bit reversed value of index i for a sequence of n points
+//
+
+static int  bitRev (
+    int        i,             // Index to be bit reversed
+    const int  n              // Number of points, a power of two
+) {
+    int  k, r = 0;
+
+    for (k=1; k<n; k*=2) {
+        r = 2*r + (i & 1);
+        i /= 2;
+    }
+    return  r;
+}
+
+
+
+//==============================================================================
+// Return the digit reversed value of index i for the mixed radix transform
+//
+// For the factors f[0], f[1], ... of n and the digits d0=i%f[0],
+// d1=(i/f[0])%f[1], ... of i the result is
+//   d0*n/f[0] + d1*n/(f[0]*f[1]) + ...
+// For n being a power of two this is the bit reversed value of i.
+//
+
+static int  digitRev (
+    int         i,            // Index to be digit reversed
+    const int  *f             // Prime factors of n, terminated by 0
+) {
+    int  l, len, r = 0;
+
+    for (len=1,l=0; f[l]; ++l)  len *= f[l];
+    for (l=0; f[l]; ++l) {
+        len /= f[l];
+        r += (i % f[l]) * len;
+        i /= f[l];
+    }
+    return  r;
+}
+
+
+
+//==============================================================================
+// Return the input order of the transform of length n without bit reversal
+//
+// pos[k] is set to the index where element k is expected at the input of the
+// transform generated by fftGen() with noBitRev set. That is the bit reversed
+// or digit reversed value of k, which are involutions, unless Rader's
+// algorithm or the prime factor algorithm is used, which read their input in
+// natural order.
+//
+
+static void  inputOrder (
+    const int  n,             // Number of points
+    int       *pos            // Returned input positions of the elements
+) {
+    int  f[32];                 // Prime factors of n
+    int  k;
+
+    factorize (n, f);
+    for (k=0; k<n; ++k) {
+        if ((n & (n-1)) == 0) {
+            pos[k] = bitRev (k, n);
+        } else if ((n > 7  &&  isPrime (n))  ||  coprimeFactors (n, NULL) > 1) {
+            pos[k] = k;
+        } else {
+            pos[k] = digitRev (k, f);
+        }
+    }
+}
+
+
+
+//==============================================================================
+// Factorize n into the prime factors 2, 3, 5, and 7
+//
+// The factors are stored in f[] in ascending order, terminated by 0. So f[]
+// must provide space for up to 32 elements. Returns the part of n that has no
+// such factors, i.e. 1 if n is a product of the prime factors 2, 3, 5, and 7.
+//
+
+static int  factorize (
+    int   n,                  // Number to be factorized, n>0
+    int  *f                   // Returned prime factors of n
+) {
+    static const int  primes[] = {2, 3, 5, 7};
+    int  i, nf;
+
+    for (nf=0,i=0; i<4; ++i) {
+        while (n % primes[i] == 0) {
+            f[nf++] = primes[i];
+            n /= primes[i];
+        }
+    }
+    f[nf] = 0;
+    return  n;
+}
+
+
+
+//==============================================================================
+// Split n into coprime factors
+//
+// Groups the prime factors of n, see factorize(), into the prime powers
+// q[0]...q[L-1], e.g. 360=8*9*5, and returns their number L. q[] must provide
+// space for up to 4 elements, it may be NULL if only L is required.
+//
+
+static int  coprimeFactors (
+    const int   n,            // Number to be split, n>0
+    int        *q             // Returned coprime factors of n or NULL
+) {
+    int  f[32];                 // Prime factors of n
+    int  l, nq, qq;
+
+    factorize (n, f);
+    for (nq=0,l=0; f[l]; ++nq) {
+        for (qq=f[l++]; f[l] == f[l-1]; ++l)  qq *= f[l];
+        if (q != NULL)  q[nq] = qq;
+    }
+    return  nq;
+}
+
+
+
+//==============================================================================
+// Return 1 if n is a prime number, 0 otherwise
+//
+
+static int  isPrime (
+    const int  n              // Number to be checked
+) {
+    int  d;
+
+    if (n < 2)  return 0;
+    for (d=2; d*d<=n; ++d) {
+        if (n % d == 0)  return 0;
+    }
+    return  1;
 }
 
 
@@ -1235,12 +6065,50 @@ static void  info (
         "Usage: fftGen [option...]\n"
         "Options:\n"
         "Mandatory arguments to long options are mandatory for short options too.\n"
-        " -n, --points NUMBER   Number of points, must be a power of 2.\n"
+        " -n, --points NUMBER   Number of points, product of 2, 3, 5, and 7, or a\n"
+        "                       prime p with p-1 being such a product, or ROWSxCOLS\n"
+        "                       or PLANESxROWSxCOLS for a 2D or 3D FFT.\n"
         " -i, --inverse         Generate code for inverse FFT.\n"
         " -r, --real-in-opt     Optimize for real only input.\n"
         " -o, --real-out-opt    Optimize for real only output.\n"
         " -m, --symm-in-opt     Optimize for symmetry at input sequence.\n"
         " -s, --symm-out-opt    Optimize for symmetry at output sequence.\n"
+        " -R, --radix NUMBER    Radix of the butterflies, 2 (default) or 4.\n"
+        " -S, --split-radix     Use the split-radix algorithm.\n"
+        " -d, --dif             Use decimation in frequency.\n"
+        " -b, --no-bitrev       Omit the bit reversal permutation.\n"
+        " -k, --stockham        Use the Stockham autosort algorithm (out of place).\n"
+        " -p, --out-of-place    Read the input from const arrays xr_in and xi_in.\n"
+        " -I, --istride STRIDE  Stride of the input elements, a number or the name\n"
+        "                       of a variable, default 1.\n"
+        " -O, --ostride STRIDE  Stride of the output elements, the same with -p or\n"
+        "                       -k, otherwise of all elements.\n"
+        " -f, --real-fft        Generate a real FFT on one real array.\n"
+        " -C, --dct2            Generate a DCT-II on one real array.\n"
+        " -D, --dct3            Generate a DCT-III on one real array.\n"
+        " -M, --mdct            Generate an MDCT, with -i an IMDCT, on one real array.\n"
+        " -w, --sine-window     Apply the sine window with -M.\n"
+        " -Z, --bluestein       Use the Bluestein algorithm for any number of points.\n"
+        " -B, --bins NUMBER     Number of bins with -Z, default number of points.\n"
+        " -F, --start-bin NUMBER\n"
+        "                       Frequency of the first bin with -Z, default 0.\n"
+        " -W, --bin-spacing NUMBER\n"
+        "                       Spacing of the bins with -Z, default 1.\n"
+        " -K, --block NUMBER    Number of columns transformed together with\n"
+        "                       -n ROWSxCOLS, default 0: one after the other.\n"
+        " -N, --batch NUMBER    Number of interleaved signals, default 1.\n"
+        " -e, --function NAME   Generate a complete function with restrict arrays.\n"
+        " -t, --type TYPE       Type of the arrays with -e, -T, or -L, default double.\n"
+        " -A, --align NUMBER    Alignment of the arrays in bytes with -e.\n"
+        " -T, --twiddle-table   Store the constants in a table.\n"
+        " -L, --codelet NUMBER  Number of points of the unrolled codelets,\n"
+        "                       default 0: unroll the whole FFT.\n"
+        " -x, --simd NAME       Use the intrinsics of SIMD instruction set NAME,\n"
+        "                       sse2, avx2, or vecN for vectors of N bytes, with -e.\n"
+        " -c, --layout LAYOUT   Layout of the complex values, split (default),\n"
+        "                       interleaved, or c99complex.\n"
+        " -u, --cmul FORM       Form of the complex multiplications, plain\n"
+        "                       (default), fma, 3mul, or ratio.\n"
         " -l, --license         Write a GPL 3 note at the beginning of the code.\n"
         " -v, --verbose         Increase verbosity level.\n"
         "                       Verbose output is directed to stderr.\n"
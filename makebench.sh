@@ -0,0 +1,62 @@
+#!/bin/bash
+#
+# Benchmark script to compare the literal constants of the code generated by
+# fftGen with the table of constants generated by option -T
+#
+# Usage: ./makebench.sh [N [CALLS [OPTIONS]]]
+#
+#   N        Number of points, default 1024
+#   CALLS    Number of calls of the FFT to measure, default 10000
+#   OPTIONS  Further options of fftGen, e.g. "-S"
+#
+# The type of the array elements is taken from the environment variable TYPE,
+# default double, the compiler options from CFLAGS, default -O2.
+#
+# For both variants the script reports the number of generated lines, the size
+# of the code (.text) and of the read-only data (.rodata) of the compiled FFT,
+# and the mean time of one call. The size of .text is the footprint in the
+# instruction cache.
+#
+# Version 1   2026 Oct 16th
+#
+#-------------------------------------------------------------------------------
+# Copyright (C) 2026  Jost Brachert, jost.brachert@gmx.de
+#
+# This program is free software: you can redistribute it and/or modify it under
+# the terms of the GNU General Public License as published by the Free Software
+# Foundation; either version 3 of the license, or (at your option) any later
+# version.
+#
+# This program is distributed in the hope that it will be useful, but WITHOUT
+# ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+# FOR A PARTICULAR PURPOSE. See the GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License along with
+# this program, see file COPYING. If not, see https://www.gnu.org/licenses/.
+#
+
+project="fftGen"
+
+CFLAGS="${CFLAGS:--O2}"
+n="${1:-1024}"
+calls="${2:-10000}"
+options="$3"
+type="${TYPE:-double}"
+
+cd test || exit
+
+for mode in Literal Table ; do
+    if [ $mode = Table ] ; then
+        opt="-T"
+    else
+        opt=""
+    fi
+    ../$project $opt $options -e fft -t "$type" -n$n > fft$mode.c || exit
+    gcc $CFLAGS -c -o fft$mode.o fft$mode.c || exit
+    gcc $CFLAGS -DN=$n -DFFT_TYPE="$type"\
+     -o fftBench$mode fftBench.c fft$mode.o || exit
+    echo "$mode constants:"
+    echo "    $(wc -l < fft$mode.c) lines"
+    size -A fft$mode.o | awk '$1 ~ /^\.(text|rodata)/ {print "    "$1" "$2" bytes"}'
+    echo "    $(./fftBench$mode $calls)"
+done
@@ -23,7 +23,7 @@
 project="fftGen"
 
 CFLAGS="-Wall"
-CFLAGS="-lm"
+LDFLAGS="-lm"
 source="../$project.c"
 
 testscrdir="scripts"
@@ -37,7 +37,7 @@ rm -v $project.gcda
 #-------------------------------------------------------------------------------
 # Create instrumented code
 # => test/$project.gcno, test/$project
-gcc -fprofile-arcs -ftest-coverage $CFLAGS $LDFLAGS -o $project $source
+gcc -fprofile-arcs -ftest-coverage $CFLAGS -o $project $source $LDFLAGS
 
 #-------------------------------------------------------------------------------
 # Run tests
@@ -77,22 +77,78 @@ echo -e "    Expecting error message" >>stderr.log
 ./$project y >>stdout.log 2>>stderr.log
 
 echo -e "${sep}Test verbosity\nTest option assignment by =
-Test option argument to -n is not power of 2"|\
+Test option argument to -n is not supported"|\
     tee -a stderr.log >>stdout.log
 echo -e "    Expecting error message" >>stderr.log
-./$project -vn=7 >>stdout.log 2>>stderr.log
+./$project -vn=22 >>stdout.log 2>>stderr.log
 
 echo -e "${sep}Test invalid option argument"|\
     tee -a stderr.log >>stdout.log
 echo -e "    Expecting error message" >>stderr.log
 ./$project -vn x >>stdout.log 2>>stderr.log
 
+echo -e "${sep}Test invalid radix"|\
+    tee -a stderr.log >>stdout.log
+echo -e "    Expecting error message" >>stderr.log
+./$project -R3 -n8 >>stdout.log 2>>stderr.log
+
+echo -e "${sep}Test conflicting options"|\
+    tee -a stderr.log >>stdout.log
+echo -e "    Expecting error message" >>stderr.log
+./$project -S -R4 -n8 >>stdout.log 2>>stderr.log
+./$project -d -S -n8 >>stdout.log 2>>stderr.log
+./$project -k -d -n8 >>stdout.log 2>>stderr.log
+./$project -S -n12 >>stdout.log 2>>stderr.log
+./$project -f -n15 >>stdout.log 2>>stderr.log
+./$project -Z -r -n8 >>stdout.log 2>>stderr.log
+./$project -B4 -n8 >>stdout.log 2>>stderr.log
+./$project -f -rs -n8 >>stdout.log 2>>stderr.log
+./$project -C -n9 >>stdout.log 2>>stderr.log
+./$project -C -i -n8 >>stdout.log 2>>stderr.log
+./$project --dct2 --dct3 -n8 >>stdout.log 2>>stderr.log
+./$project -M -n10 >>stdout.log 2>>stderr.log
+./$project -M -f -n8 >>stdout.log 2>>stderr.log
+./$project -w -n8 >>stdout.log 2>>stderr.log
+./$project -f -n4x4 >>stdout.log 2>>stderr.log
+./$project -K2 -n8 >>stdout.log 2>>stderr.log
+./$project -K2 -n12x4 >>stdout.log 2>>stderr.log
+./$project -K-1 -n4x4 >>stdout.log 2>>stderr.log
+./$project -n8x22 >>stdout.log 2>>stderr.log
+./$project -n8x >>stdout.log 2>>stderr.log
+./$project -K2 -n8x12x4 >>stdout.log 2>>stderr.log
+./$project -n4x4x22 >>stdout.log 2>>stderr.log
+./$project -N4 -f -n8 >>stdout.log 2>>stderr.log
+./$project -N-1 -n8 >>stdout.log 2>>stderr.log
+./$project -t float -n8 >>stdout.log 2>>stderr.log
+./$project -e fft -A24 -n8 >>stdout.log 2>>stderr.log
+./$project -T -A16 -n8 >>stdout.log 2>>stderr.log
+./$project -L64 -r -n1024 >>stdout.log 2>>stderr.log
+./$project -L48 -n1024 >>stdout.log 2>>stderr.log
+./$project -L64 -n960 >>stdout.log 2>>stderr.log
+./$project -x sse2 -n8 >>stdout.log 2>>stderr.log
+./$project -x avx512 -e fft -n8 >>stdout.log 2>>stderr.log
+./$project -x vec12 -e fft -n8 >>stdout.log 2>>stderr.log
+./$project -c planar -n8 >>stdout.log 2>>stderr.log
+./$project -c interleaved -f -n8 >>stdout.log 2>>stderr.log
+./$project -p -d -n8 >>stdout.log 2>>stderr.log
+./$project -p -n12 >>stdout.log 2>>stderr.log
+./$project -I 0 -n8 >>stdout.log 2>>stderr.log
+./$project -I 2 -O s -n8 >>stdout.log 2>>stderr.log
+./$project -O s -N2 -n8 >>stdout.log 2>>stderr.log
+./$project -e fft -I tr -n8 >>stdout.log 2>>stderr.log
+./$project -O int -n8 >>stdout.log 2>>stderr.log
+./$project -e fft -I fft -n8 >>stdout.log 2>>stderr.log
+./$project -x sse2 -e fft -S -n8 >>stdout.log 2>>stderr.log
+./$project -x sse2 -e fft -t int -n8 >>stdout.log 2>>stderr.log
+./$project -u foo -n8 >>stdout.log 2>>stderr.log
+./$project -u fma -e fft -t int -n8 >>stdout.log 2>>stderr.log
+
 echo -e "${sep}Test 2-point FFT\nTest short option license output"|\
     tee -a stderr.log >>stdout.log
 ./$project -ln2 2>>stderr.log | tee fft.c >>stdout.log
 ./$project -in2 > ffti.c 2>>stderr.log
-gcc $CFLAGS -DM=1 -DNON_ZERO_IMAG_INPUT -o fftTest fftTest.c 2>>stderr.log
-if ! fftTest 2>>stderr.log ; then
+gcc $CFLAGS -DM=1 -DNON_ZERO_IMAG_INPUT -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
     echo -e "\nTest failed, see stderr.log\n"
 fi
 
@@ -101,8 +157,8 @@ Test verbosity regarding license"|\
     tee -a stderr.log >>stdout.log
 ./$project -vln4 2>>stderr.log | tee fft.c >>stdout.log
 ./$project -in4 > ffti.c 2>>stderr.log
-gcc $CFLAGS -DM=2 -DNON_ZERO_IMAG_INPUT -o fftTest fftTest.c 2>>stderr.log
-if ! fftTest 2>>stderr.log ; then
+gcc $CFLAGS -DM=2 -DNON_ZERO_IMAG_INPUT -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
     echo -e "\nTest failed, see stderr.log\n"
 fi
 
@@ -110,8 +166,8 @@ echo -e "${sep}Test 8-point FFT\nTest no space before option argument"|\
     tee -a stderr.log >>stdout.log
 ./$project -n8  > fft.c  2>>stderr.log
 ./$project -in8 > ffti.c 2>>stderr.log
-gcc $CFLAGS -DM=3 -DNON_ZERO_IMAG_INPUT -o fftTest fftTest.c 2>>stderr.log
-if ! fftTest 2>>stderr.log ; then
+gcc $CFLAGS -DM=3 -DNON_ZERO_IMAG_INPUT -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
     echo -e "\nTest failed, see stderr.log\n"
 fi
 
@@ -120,8 +176,8 @@ Test -n and -i long option"|\
     tee -a stderr.log >>stdout.log
 ./$project -n 16  > fft.c  2>>stderr.log
 ./$project --inverse --points 16 > ffti.c 2>>stderr.log
-gcc $CFLAGS -DM=4 -DNON_ZERO_IMAG_INPUT -o fftTest fftTest.c 2>>stderr.log
-if ! fftTest 2>>stderr.log ; then
+gcc $CFLAGS -DM=4 -DNON_ZERO_IMAG_INPUT -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
     echo -e "\nTest failed, see stderr.log\n"
 fi
 
@@ -130,8 +186,8 @@ Test separate short options"|\
     tee -a stderr.log >>stdout.log
 ./$project -n=32 > fft.c  2>>stderr.log
 ./$project -i -n=32 > ffti.c 2>>stderr.log
-gcc $CFLAGS -DM=5 -DNON_ZERO_IMAG_INPUT -o fftTest fftTest.c 2>>stderr.log
-if ! fftTest 2>>stderr.log ; then
+gcc $CFLAGS -DM=5 -DNON_ZERO_IMAG_INPUT -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
     echo -e "\nTest failed, see stderr.log\n"
 fi
 
@@ -139,8 +195,8 @@ echo -e "${sep}Test 32-point FFT\nTest option -r"|\
     tee -a stderr.log >>stdout.log
 ./$project -rn32 > fft.c  2>>stderr.log
 ./$project -in32 > ffti.c 2>>stderr.log
-gcc $CFLAGS -DM=5 -DREAL_IN_OPTIMIZED -o fftTest fftTest.c 2>>stderr.log
-if ! fftTest 2>>stderr.log ; then
+gcc $CFLAGS -DM=5 -DREAL_IN_OPTIMIZED -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
     echo -e "\nTest failed, see stderr.log\n"
 fi
 
@@ -148,8 +204,8 @@ echo -e "${sep}Test 64-point FFT\nTest option -s"|\
     tee -a stderr.log >>stdout.log
 ./$project -sn64 > fft.c  2>>stderr.log
 ./$project -in64 > ffti.c 2>>stderr.log
-gcc $CFLAGS -DM=6 -DSYMM_OUT_OPTIMIZED -o fftTest fftTest.c 2>>stderr.log
-if ! fftTest 2>>stderr.log ; then
+gcc $CFLAGS -DM=6 -DSYMM_OUT_OPTIMIZED -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
     echo -e "\nTest failed, see stderr.log\n"
 fi
 
@@ -159,8 +215,8 @@ Test verbosity regarding -r and -s"|\
     tee -a stderr.log >>stdout.log
 ./$project --verbose --real-in-opt --symm-out-opt -n64 > fft.c  2>>stderr.log
 ./$project -in64 > ffti.c 2>>stderr.log
-gcc $CFLAGS -DM=6 -DREAL_IN_OPTIMIZED -DSYMM_OUT_OPTIMIZED -o fftTest fftTest.c 2>>stderr.log
-if ! fftTest 2>>stderr.log ; then
+gcc $CFLAGS -DM=6 -DREAL_IN_OPTIMIZED -DSYMM_OUT_OPTIMIZED -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
     echo -e "\nTest failed, see stderr.log\n"
 fi
 
@@ -168,8 +224,8 @@ echo -e "${sep}Test 128-point FFT\nTest option -m"|\
     tee -a stderr.log >>stdout.log
 ./$project -n128 > fft.c  2>>stderr.log
 ./$project -imn128 > ffti.c 2>>stderr.log
-gcc $CFLAGS -DM=7 -DSYMM_IN_OPTIMIZED -o fftTest fftTest.c 2>>stderr.log
-if ! fftTest 2>>stderr.log ; then
+gcc $CFLAGS -DM=7 -DSYMM_IN_OPTIMIZED -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
     echo -e "\nTest failed, see stderr.log\n"
 fi
 
@@ -177,8 +233,8 @@ echo -e "${sep}Test 256-point FFT\nTest option -o"|\
     tee -a stderr.log >>stdout.log
 ./$project -n256 > fft.c  2>>stderr.log
 ./$project -ion256 > ffti.c 2>>stderr.log
-gcc $CFLAGS -DM=8 -DREAL_OUT_OPTIMIZED -o fftTest fftTest.c 2>>stderr.log
-if ! fftTest 2>>stderr.log ; then
+gcc $CFLAGS -DM=8 -DREAL_OUT_OPTIMIZED -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
     echo -e "\nTest failed, see stderr.log\n"
 fi
 
@@ -188,8 +244,8 @@ Test -m and -o long option\nTest verbosity regarding -m and -o"|\
 ./$project -n512 > fft.c  2>>stderr.log
 ./$project -vi --symm-in-opt --real-out-opt -n512 > ffti.c 2>>stderr.log
 gcc $CFLAGS -DEPS=1.e-7 -DM=9\
- -DSYMM_IN_OPTIMIZED -DREAL_OUT_OPTIMIZED -o fftTest fftTest.c 2>>stderr.log
-if ! fftTest 2>>stderr.log ; then
+ -DSYMM_IN_OPTIMIZED -DREAL_OUT_OPTIMIZED -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
     echo -e "\nTest failed, see stderr.log\n"
 fi
 
@@ -199,8 +255,682 @@ echo -e "${sep}Test 1024-point FFT\nTest options -r, -s, -m, -o\n"|\
 ./$project -imon1024 > ffti.c 2>>stderr.log
 gcc $CFLAGS -DEPS=1.e-7 -DM=10\
  -DREAL_IN_OPTIMIZED -DSYMM_OUT_OPTIMIZED -DSYMM_IN_OPTIMIZED -DREAL_OUT_OPTIMIZED\
- -o fftTest fftTest.c 2>>stderr.log
-if ! fftTest 2>>stderr.log ; then
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 256-point FFT\nTest option -R\nTest verbosity regarding -R"|\
+    tee -a stderr.log >>stdout.log
+./$project -vR4 -n256 > fft.c  2>>stderr.log
+./$project -i --radix 4 -n256 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=8 -DNON_ZERO_IMAG_INPUT -DFFT_TEMPS="tr,ti,ur,ui,vr,vi"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 8-point FFT\nTest option --radix with odd number of stages
+Test options -r, -s, -m, -o with radix 4"|\
+    tee -a stderr.log >>stdout.log
+./$project --radix=4 -rsn8 2>>stderr.log | tee fft.c >>stdout.log
+./$project -R4 -imon8 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=3 -DFFT_TEMPS="tr,ti,ur,ui,vr,vi"\
+ -DREAL_IN_OPTIMIZED -DSYMM_OUT_OPTIMIZED -DSYMM_IN_OPTIMIZED -DREAL_OUT_OPTIMIZED\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 512-point FFT\nTest options -r, -s, -m, -o with radix 4\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -R4 -rsn512 > fft.c  2>>stderr.log
+./$project -R4 -imon512 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DEPS=1.e-7 -DM=9 -DFFT_TEMPS="tr,ti,ur,ui,vr,vi"\
+ -DREAL_IN_OPTIMIZED -DSYMM_OUT_OPTIMIZED -DSYMM_IN_OPTIMIZED -DREAL_OUT_OPTIMIZED\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 64-point FFT\nTest option -S\nTest verbosity regarding -S"|\
+    tee -a stderr.log >>stdout.log
+./$project -vSn64 > fft.c  2>>stderr.log
+./$project -i --split-radix -n64 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=6 -DNON_ZERO_IMAG_INPUT -DFFT_TEMPS="tr,ti,ur,ui,vr,vi"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 1024-point FFT\nTest options -r, -s, -m, -o with split-radix\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -S -rsn1024 > fft.c  2>>stderr.log
+./$project -S -imon1024 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DEPS=1.e-7 -DM=10 -DFFT_TEMPS="tr,ti,ur,ui,vr,vi"\
+ -DREAL_IN_OPTIMIZED -DSYMM_OUT_OPTIMIZED -DSYMM_IN_OPTIMIZED -DREAL_OUT_OPTIMIZED\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 128-point FFT\nTest decimation in frequency\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v --dif -n128 > fft.c  2>>stderr.log
+./$project -in128 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=7 -DNON_ZERO_IMAG_INPUT -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 8-point FFT\nTest options -r, -s, -m, -o with decimation in frequency\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -drsn8 2>>stderr.log | tee fft.c >>stdout.log
+./$project -dimon8 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=3\
+ -DREAL_IN_OPTIMIZED -DSYMM_OUT_OPTIMIZED -DSYMM_IN_OPTIMIZED -DREAL_OUT_OPTIMIZED\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 256-point FFT\nTest omission of the bit reversal permutation\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -vdbn256 > fft.c  2>>stderr.log
+./$project -vi --no-bitrev -n256 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=8 -DNON_ZERO_IMAG_INPUT -DBIT_REVERSED_ORDER\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 512-point FFT\nTest options -r, -s, -m, -o without bit reversal\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -db -rsn512 > fft.c  2>>stderr.log
+./$project -ib -mon512 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=9 -DBIT_REVERSED_ORDER\
+ -DREAL_IN_OPTIMIZED -DSYMM_OUT_OPTIMIZED -DSYMM_IN_OPTIMIZED -DREAL_OUT_OPTIMIZED\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 64-point FFT\nTest Stockham autosort algorithm\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v --stockham -n64 > fft.c  2>>stderr.log
+./$project -ikn64 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=6 -DNON_ZERO_IMAG_INPUT -DOUT_OF_PLACE\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 8-point and 512-point FFT\nTest options -r, -s, -m, -o with Stockham algorithm\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -krsn8 2>>stderr.log | tee fft.c >>stdout.log
+./$project -k -imon8 > ffti.c 2>>stderr.log
+./$project -k -rsn512 > fft.c  2>>stderr.log
+./$project -k -imon512 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=9 -DOUT_OF_PLACE\
+ -DREAL_IN_OPTIMIZED -DSYMM_OUT_OPTIMIZED -DSYMM_IN_OPTIMIZED -DREAL_OUT_OPTIMIZED\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 8-point and 64-point FFT\nTest out-of-place transform\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -p -n8 2>>stderr.log | tee fft.c >>stdout.log
+./$project -p -R4 -n64 > fft.c  2>>stderr.log
+./$project -i --out-of-place -S -n64 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=6 -DNON_ZERO_IMAG_INPUT -DOUT_OF_PLACE -DFFT_TEMPS="tr,ti,ur,ui,vr,vi"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 8-point and 512-point FFT\nTest options -r, -s, -m, -o out of place\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -p -imon8 2>>stderr.log | tee ffti.c >>stdout.log
+./$project -p -rsn512 > fft.c  2>>stderr.log
+./$project -p -imon512 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=9 -DOUT_OF_PLACE\
+ -DREAL_IN_OPTIMIZED -DSYMM_OUT_OPTIMIZED -DSYMM_IN_OPTIMIZED -DREAL_OUT_OPTIMIZED\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test batch of three 16-point FFTs out of place\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -p -N3 -n16 > fft.c  2>>stderr.log
+./$project -p -i -N3 -n16 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=4 -DBATCH=3 -DNON_ZERO_IMAG_INPUT -DOUT_OF_PLACE\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 64-point FFT out of place as complete function\nTest const input arrays with vector extensions\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -p -x vec32 -e fft -A32 -n64 2>>stderr.log | tee fft.c >>stdout.log
+./$project -p -i -T -e ffti -n64 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=6 -DFUNCTION -DNON_ZERO_IMAG_INPUT -DOUT_OF_PLACE\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 64-point FFT on every third element\nTest constant strides\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -O3 -e fft -n64 2>>stderr.log | tee fft.c >>stdout.log
+./$project -I 3 -i -R4 -e ffti -n64 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=6 -DFUNCTION -DSTRIDE=3 -DNON_ZERO_IMAG_INPUT\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 60-point FFT on one channel of eight\nTest strides given at run time\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -I ch -e fft -n60 2>>stderr.log | tee fft.c >>stdout.log
+./$project --istride=ch -i -e ffti -n60 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=5 -DN=60 -DFUNCTION -DSTRIDE=8 -DSTRIDE_ARGS=,8 -DNON_ZERO_IMAG_INPUT\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 32-point FFT out of place with different strides\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -p -I is -O os -e fft -n32 > fft.c  2>>stderr.log
+./$project -k --istride is --ostride os -i -e ffti -n32 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=5 -DFUNCTION -DOUT_OF_PLACE -DIN_STRIDE=2 -DSTRIDE=3 -DSTRIDE_ARGS=,2,3\
+ -DNON_ZERO_IMAG_INPUT -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 64-point FFT with fma() calls\nTest inverse FFT in ratio form\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -u fma -e fft -n64 2>>stderr.log | tee fft.c >>stdout.log
+./$project -u ratio -i -R4 -e ffti -n64 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=6 -DFUNCTION -DNON_ZERO_IMAG_INPUT -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 49-point FFT with 3 multiplications\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v --cmul 3mul -n49 2>>stderr.log | tee fft.c >>stdout.log
+./$project --cmul=3mul -i -n49 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=5 -DN=49 -DNON_ZERO_IMAG_INPUT -DFFT_TEMPS="tr,ti,ur,ui,tk,br[7],bi[7]"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 16-point FFT\nTest real FFT and inverse real FFT\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v --real-fft -n16 2>>stderr.log | tee fft.c >>stdout.log
+./$project -i --real-fft -n16 2>>stderr.log | tee ffti.c >>stdout.log
+gcc $CFLAGS -DM=4 -DREAL_FFT -DREAL_IFFT -DFFT_TEMPS="tr,ti,ur,ui,vr,vi"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 1024-point FFT\nTest real FFT and inverse real FFT with split-radix\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -f -S -n1024 > fft.c  2>>stderr.log
+./$project -fiSn1024 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DEPS=1.e-7 -DM=10 -DREAL_FFT -DREAL_IFFT -DFFT_TEMPS="tr,ti,ur,ui,vr,vi"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 15-point FFT\nTest prime factor algorithm\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -n15 2>>stderr.log | tee fft.c >>stdout.log
+./$project -i --points 15 2>>stderr.log | tee ffti.c >>stdout.log
+gcc $CFLAGS -DM=3 -DN=15 -DNON_ZERO_IMAG_INPUT -DFFT_TEMPS="tr,ti,ur,ui,br[7],bi[7]"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 210-point FFT\nTest prime factor algorithm for factors 2, 3, 5, and 7\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -n210 > fft.c  2>>stderr.log
+./$project -in210 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=7 -DN=210 -DNON_ZERO_IMAG_INPUT -DFFT_TEMPS="tr,ti,ur,ui,br[7],bi[7]"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 27-point FFT\nTest mixed-radix butterflies\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -n27 > fft.c  2>>stderr.log
+./$project -in27 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=4 -DN=27 -DNON_ZERO_IMAG_INPUT -DFFT_TEMPS="tr,ti,ur,ui,br[7],bi[7]"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 360-point FFT\nTest prime factor algorithm with mixed-radix factors 8 and 9\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -n360 > fft.c  2>>stderr.log
+./$project -in360 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=8 -DN=360 -DNON_ZERO_IMAG_INPUT -DFFT_TEMPS="tr,ti,ur,ui,br[7],bi[7]"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 960-point FFT\nTest real FFT and inverse real FFT with the prime factor algorithm\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -f -n960 > fft.c  2>>stderr.log
+./$project -fin960 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DEPS=1.e-7 -DM=9 -DN=960 -DREAL_FFT -DREAL_IFFT\
+ -DFFT_TEMPS="tr,ti,ur,ui,vr,vi,br[7],bi[7]"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 31-point FFT\nTest Rader's algorithm\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -n31 2>>stderr.log | tee fft.c >>stdout.log
+./$project -in31 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=4 -DN=31 -DNON_ZERO_IMAG_INPUT -DFFT_TEMPS="tr,ti,ur,ui,br[7],bi[7]"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 257-point FFT\nTest Rader's algorithm with split-radix\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -n257 > fft.c  2>>stderr.log
+./$project -in257 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DEPS=1.e-7 -DM=8 -DN=257 -DFFT_TEMPS="tr,ti,ur,ui,vr,vi"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 254-point FFT\nTest real FFT and inverse real FFT with Rader's algorithm\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -f -n254 > fft.c  2>>stderr.log
+./$project -fin254 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DEPS=1.e-7 -DM=7 -DN=254 -DREAL_FFT -DREAL_IFFT\
+ -DFFT_TEMPS="tr,ti,ur,ui,vr,vi,br[7],bi[7]"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 23-point FFT\nTest the Bluestein algorithm\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v --bluestein -n23 > fft.c  2>>stderr.log
+./$project -iZn23 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=4 -DN=23 -DARRAY_SIZE=64 -DNON_ZERO_IMAG_INPUT\
+ -DFFT_TEMPS="tr,ti,ur,ui,vr,vi" -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 100-point FFT\nTest zoom spectrum by the Bluestein algorithm\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -Z -B37 --start-bin=-3.25 -W 0.37 -n100 > fft.c  2>>stderr.log
+gcc $CFLAGS -DM=6 -DN=100 -DARRAY_SIZE=256 -DNON_ZERO_IMAG_INPUT -DCHIRP_Z\
+ -DBINS=37 -DSTART_BIN=-3.25 -DBIN_SPACING=0.37\
+ -DFFT_TEMPS="tr,ti,ur,ui,vr,vi" -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 8-point DCT\nTest DCT-II and DCT-III\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -C -n8 2>>stderr.log | tee fft.c >>stdout.log
+./$project -v --dct3 --points 8 2>>stderr.log | tee ffti.c >>stdout.log
+gcc $CFLAGS -DM=3 -DDCT -DFFT_TEMPS="tr,ti,ur,ui,vr,vi"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 64-point DCT\nTest DCT-II and DCT-III with split-radix algorithm\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -SCn64 > fft.c  2>>stderr.log
+./$project -SDn64 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=6 -DDCT -DFFT_TEMPS="tr,ti,ur,ui,vr,vi"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 60-point DCT\nTest DCT-II and DCT-III with the prime factor algorithm\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -Cn60 > fft.c  2>>stderr.log
+./$project -Dn60 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=5 -DN=60 -DDCT -DFFT_TEMPS="tr,ti,ur,ui,vr,vi,br[7],bi[7]"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 16-point MDCT\nTest MDCT and IMDCT with radix-4 butterflies\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -M -R4 -n16 2>>stderr.log | tee fft.c >>stdout.log
+./$project -v --mdct --inverse --radix 4 --points 16 2>>stderr.log | tee ffti.c >>stdout.log
+gcc $CFLAGS -DM=4 -DMDCT -DFFT_TEMPS="tr,ti,ur,ui,vr,vi"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 256-point MDCT\nTest MDCT and IMDCT with sine window and split-radix algorithm\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -SMw -n256 2>>stderr.log > fft.c
+./$project --sine-window -SMi -n256 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=8 -DMDCT -DSINE_WINDOW -DFFT_TEMPS="tr,ti,ur,ui,vr,vi"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 36-point MDCT\nTest MDCT and IMDCT with sine window and mixed-radix butterflies\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -Mw -n36 > fft.c  2>>stderr.log
+./$project -Miw -n36 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=5 -DN=36 -DMDCT -DSINE_WINDOW -DFFT_TEMPS="tr,ti,ur,ui,br[7],bi[7]"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 4x8-point 2D FFT\nTest row-column mode and decimation in frequency in blocks\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -n4x8 2>>stderr.log | tee fft.c >>stdout.log
+./$project -i -d -K3 --points=4x8 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=5 -DCOLS=8 -DNON_ZERO_IMAG_INPUT\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 16x16-point 2D FFT\nTest blocks of columns with split-radix algorithm\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -S -K4 -n16x16 2>>stderr.log > fft.c
+./$project -i -S --block 4 -n16x16 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=8 -DCOLS=16 -DNON_ZERO_IMAG_INPUT -DFFT_TEMPS="tr,ti,ur,ui,vr,vi"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 8x16-point 2D FFT\nTest blocks not dividing the columns, real input and output\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -r -S -K5 -n8x16 2>>stderr.log > fft.c
+./$project -v -o -i -R4 -K5 -n8x16 2>>stderr.log > ffti.c
+gcc $CFLAGS -DM=7 -DCOLS=16 -DREAL_IN_OPTIMIZED -DREAL_OUT_OPTIMIZED\
+ -DFFT_TEMPS="tr,ti,ur,ui,vr,vi" -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 15x11-point 2D FFT\nTest prime factor and Rader's algorithm in 2D\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -n15x11 > fft.c  2>>stderr.log
+./$project -in15x11 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=7 -DN=165 -DCOLS=11 -DNON_ZERO_IMAG_INPUT -DFFT_TEMPS="tr,ti,ur,ui,br[7],bi[7]"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 4x4x8-point 3D FFT\nTest blocks of columns along the planes\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -R4 -K2 -n4x4x8 2>>stderr.log > fft.c
+./$project -i -S --block=8 --points 4x4x8 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=7 -DROWS=4 -DCOLS=8 -DNON_ZERO_IMAG_INPUT -DFFT_TEMPS="tr,ti,ur,ui,vr,vi"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 3x5x4-point 3D FFT\nTest mixed-radix butterflies in 3D\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -n3x5x4 2>>stderr.log > fft.c
+./$project -in3x5x4 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=5 -DN=60 -DROWS=5 -DCOLS=4 -DNON_ZERO_IMAG_INPUT -DFFT_TEMPS="tr,ti,ur,ui,br[7],bi[7]"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test batch of four 8-point FFTs\nTest radix-4 butterflies on interleaved signals\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -R4 -N4 -n8 2>>stderr.log | tee fft.c >>stdout.log
+./$project -i -R4 --batch 4 -n8 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=3 -DBATCH=4 -DNON_ZERO_IMAG_INPUT -DFFT_TEMPS="tr,ti,ur,ui,vr,vi"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test batch of three 64-point FFTs\nTest symmetry optimizations and decimation in frequency on interleaved signals\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -rsd -N3 -n64 2>>stderr.log > fft.c
+./$project -imd --batch=3 -n64 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=6 -DBATCH=3 -DREAL_IN_OPTIMIZED -DSYMM_IN_OPTIMIZED -DSYMM_OUT_OPTIMIZED\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test batch of two 60-point FFTs\nTest mixed-radix butterflies and permutation on interleaved signals\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -N2 -n60 > fft.c  2>>stderr.log
+./$project -iN2 -n60 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=5 -DN=60 -DBATCH=2 -DNON_ZERO_IMAG_INPUT -DFFT_TEMPS="tr,ti,ur,ui,br[7],bi[7]"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test batch of three 17-point FFTs\nTest Rader's algorithm on interleaved signals\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -N3 -n17 > fft.c  2>>stderr.log
+./$project -iN3 -n17 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=5 -DN=17 -DBATCH=3 -DNON_ZERO_IMAG_INPUT -DFFT_TEMPS="tr,ti,ur,ui,vr,vi"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 16-point FFT as complete function\nTest alignment hints\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -S -e fft -A16 -n16 2>>stderr.log | tee fft.c >>stdout.log
+./$project -i --function=ffti --align 16 -n16 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=4 -DFUNCTION -DNON_ZERO_IMAG_INPUT\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+if ! g++ $CFLAGS -Drestrict=__restrict -fsyntax-only -x c++ fft.c 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 30-point FFT as complete function for type float\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -e fft -t float -n30 > fft.c  2>>stderr.log
+./$project -i -e ffti --type=float -n30 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=5 -DN=30 -DFUNCTION -DFFT_TYPE=float -DEPS=1.e-5 -DNON_ZERO_IMAG_INPUT\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 8-point FFT with table of constants\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -T -n8 2>>stderr.log | tee fft.c >>stdout.log
+./$project -i --twiddle-table -n8 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=3 -DNON_ZERO_IMAG_INPUT -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 1024-point FFT with table of constants\nTest split-radix algorithm\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -T -S -n1024 > fft.c  2>>stderr.log
+./$project -T -S -i -n1024 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DEPS=1.e-7 -DM=10 -DNON_ZERO_IMAG_INPUT -DFFT_TEMPS="tr,ti,ur,ui,vr,vi"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 30-point FFT as complete function with table of constants for type float\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -T -e fft -t float -n30 > fft.c  2>>stderr.log
+./$project -T -i -e ffti -t float -n30 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=5 -DN=30 -DFUNCTION -DFFT_TYPE=float -DEPS=1.e-5 -DNON_ZERO_IMAG_INPUT\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 16-point FFT as complete function by codelets of 4 points\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -e fft -L4 -n16 2>>stderr.log | tee fft.c >>stdout.log
+./$project -i -e ffti --codelet=4 -n16 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=4 -DFUNCTION -DNON_ZERO_IMAG_INPUT\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 4096-point FFT by codelets of 256 points\nTest split-radix codelets\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -S -L256 -n4096 > fft.c  2>>stderr.log
+./$project -i -S -L256 -n4096 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DEPS=1.e-7 -DM=12 -DNON_ZERO_IMAG_INPUT -DFFT_TEMPS="tr,ti,ur,ui,vr,vi"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 1024-point FFT by codelets of 16 points with fma() calls\nTest inverse FFT with 3 multiplications\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -u fma -L16 -e fft -n1024 > fft.c  2>>stderr.log
+./$project -u 3mul -i -L16 -e ffti -n1024 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DEPS=1.e-7 -DM=10 -DFUNCTION -DNON_ZERO_IMAG_INPUT\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 8-point FFT as complete function with SSE2 intrinsics\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -x sse2 -e fft -n8 2>>stderr.log | tee fft.c >>stdout.log
+./$project -i --simd=sse2 -e ffti -n8 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=3 -DFUNCTION -DNON_ZERO_IMAG_INPUT\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 256-point FFT with SSE2 intrinsics for type float\nTest table of constants and omission of the bit reversal permutation\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -db -e fft -t float -n256 > fft.c  2>>stderr.log
+./$project -ib -T -x sse2 -e ffti -t float -A16 -n256 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=8 -DFUNCTION -DFFT_TYPE=float -DEPS=1.e-4 -DNON_ZERO_IMAG_INPUT -DBIT_REVERSED_ORDER\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 16-point FFT as complete function with AVX2 intrinsics\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -x avx2 -e fft -n16 2>>stderr.log | tee fft.c >>stdout.log
+./$project -i --simd=avx2 -e ffti -n16 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=4 -DFUNCTION -DNON_ZERO_IMAG_INPUT\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 1024-point FFT with AVX2 intrinsics for type float\nTest table of constants\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -T -x avx2 -e fft -t float -n1024 > fft.c  2>>stderr.log
+./$project -i -x avx2 -e ffti -t float -n1024 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=10 -DFUNCTION -DFFT_TYPE=float -DEPS=1.e-4 -DNON_ZERO_IMAG_INPUT\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 8-point FFT as complete function with vector extensions\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -x vec32 -e fft -n8 2>>stderr.log | tee fft.c >>stdout.log
+./$project -i --simd=vec32 -e ffti -n8 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=3 -DFUNCTION -DNON_ZERO_IMAG_INPUT\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 512-point FFT with vector extensions for type float\nTest table of constants and omission of the bit reversal permutation\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -db -e fft -t float -n512 > fft.c  2>>stderr.log
+./$project -ib -T -x vec64 -e ffti -t float -n512 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=9 -DFUNCTION -DFFT_TYPE=float -DEPS=1.e-4 -DNON_ZERO_IMAG_INPUT -DBIT_REVERSED_ORDER\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 8-point FFT on interleaved complex values\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -c interleaved -n8 2>>stderr.log | tee fft.c >>stdout.log
+./$project -i --layout=interleaved -n8 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=3 -DINTERLEAVED -DNON_ZERO_IMAG_INPUT\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 60-point FFT on interleaved complex values\nTest mixed-radix butterflies\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -c interleaved -n60 > fft.c  2>>stderr.log
+./$project -c interleaved -i -n60 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=5 -DN=60 -DINTERLEAVED -DNON_ZERO_IMAG_INPUT -DFFT_TEMPS="tr,ti,ur,ui,br[7],bi[7]"\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test batch of two 32-point FFTs on interleaved complex values\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -c interleaved -N2 -n32 > fft.c  2>>stderr.log
+./$project -c interleaved -i -N2 -n32 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=5 -DBATCH=2 -DINTERLEAVED -DNON_ZERO_IMAG_INPUT\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
+    echo -e "\nTest failed, see stderr.log\n"
+fi
+
+echo -e "${sep}Test 16-point FFT as complete function on a C99 complex array\nTest alignment hints\n"|\
+    tee -a stderr.log >>stdout.log
+./$project -v -c c99complex -e fft -A16 -n16 2>>stderr.log | tee fft.c >>stdout.log
+./$project -c c99complex -T -i -e ffti -n16 > ffti.c 2>>stderr.log
+gcc $CFLAGS -DM=4 -DFUNCTION -DINTERLEAVED -DNON_ZERO_IMAG_INPUT\
+ -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
     echo -e "\nTest failed, see stderr.log\n"
 fi
 
@@ -209,8 +939,8 @@ echo -e "${sep}Test usability for type float\n"|\
 ./$project -n32 > fft.c  2>>stderr.log
 ./$project -in32 > ffti.c 2>>stderr.log
 gcc $CFLAGS -DFFT_TYPE=float -DEPS=1.e-5 -DM=5\
- -DNON_ZERO_IMAG_INPUT -o fftTest fftTest.c 2>>stderr.log
-if ! fftTest 2>>stderr.log ; then
+ -DNON_ZERO_IMAG_INPUT -o fftTest fftTest.c $LDFLAGS 2>>stderr.log
+if ! ./fftTest 2>>stderr.log ; then
     echo -e "\nTest failed, see stderr.log\n"
 fi
 
@@ -0,0 +1,553 @@
+tr = xr[1];
+xr[1] = xr[16];
+xr[16] = tr;
+ti = xi[1];
+xi[1] = xi[16];
+xi[16] = ti;
+tr = xr[2];
+xr[2] = xr[8];
+xr[8] = tr;
+ti = xi[2];
+xi[2] = xi[8];
+xi[8] = ti;
+tr = xr[3];
+xr[3] = xr[24];
+xr[24] = tr;
+ti = xi[3];
+xi[3] = xi[24];
+xi[24] = ti;
+tr = xr[5];
+xr[5] = xr[20];
+xr[20] = tr;
+ti = xi[5];
+xi[5] = xi[20];
+xi[20] = ti;
+tr = xr[6];
+xr[6] = xr[12];
+xr[12] = tr;
+ti = xi[6];
+xi[6] = xi[12];
+xi[12] = ti;
+tr = xr[7];
+xr[7] = xr[28];
+xr[28] = tr;
+ti = xi[7];
+xi[7] = xi[28];
+xi[28] = ti;
+tr = xr[9];
+xr[9] = xr[18];
+xr[18] = tr;
+ti = xi[9];
+xi[9] = xi[18];
+xi[18] = ti;
+tr = xr[11];
+xr[11] = xr[26];
+xr[26] = tr;
+ti = xi[11];
+xi[11] = xi[26];
+xi[26] = ti;
+tr = xr[13];
+xr[13] = xr[22];
+xr[22] = tr;
+ti = xi[13];
+xi[13] = xi[22];
+xi[22] = ti;
+tr = xr[15];
+xr[15] = xr[30];
+xr[30] = tr;
+ti = xi[15];
+xi[15] = xi[30];
+xi[30] = ti;
+tr = xr[19];
+xr[19] = xr[25];
+xr[25] = tr;
+ti = xi[19];
+xi[19] = xi[25];
+xi[25] = ti;
+tr = xr[23];
+xr[23] = xr[29];
+xr[29] = tr;
+ti = xi[23];
+xi[23] = xi[29];
+xi[29] = ti;
+
+tr = xr[1];
+ti = xi[1];
+xr[1] = xr[0] - tr;
+xi[1] = xi[0] - ti;
+xr[0] += tr;
+xi[0] += ti;
+tr = xr[3];
+ti = xi[3];
+xr[3] = xr[2] - tr;
+xi[3] = xi[2] - ti;
+xr[2] += tr;
+xi[2] += ti;
+tr = xr[5];
+ti = xi[5];
+xr[5] = xr[4] - tr;
+xi[5] = xi[4] - ti;
+xr[4] += tr;
+xi[4] += ti;
+tr = xr[7];
+ti = xi[7];
+xr[7] = xr[6] - tr;
+xi[7] = xi[6] - ti;
+xr[6] += tr;
+xi[6] += ti;
+tr = xr[9];
+ti = xi[9];
+xr[9] = xr[8] - tr;
+xi[9] = xi[8] - ti;
+xr[8] += tr;
+xi[8] += ti;
+tr = xr[11];
+ti = xi[11];
+xr[11] = xr[10] - tr;
+xi[11] = xi[10] - ti;
+xr[10] += tr;
+xi[10] += ti;
+tr = xr[13];
+ti = xi[13];
+xr[13] = xr[12] - tr;
+xi[13] = xi[12] - ti;
+xr[12] += tr;
+xi[12] += ti;
+tr = xr[15];
+ti = xi[15];
+xr[15] = xr[14] - tr;
+xi[15] = xi[14] - ti;
+xr[14] += tr;
+xi[14] += ti;
+tr = xr[17];
+ti = xi[17];
+xr[17] = xr[16] - tr;
+xi[17] = xi[16] - ti;
+xr[16] += tr;
+xi[16] += ti;
+tr = xr[19];
+ti = xi[19];
+xr[19] = xr[18] - tr;
+xi[19] = xi[18] - ti;
+xr[18] += tr;
+xi[18] += ti;
+tr = xr[21];
+ti = xi[21];
+xr[21] = xr[20] - tr;
+xi[21] = xi[20] - ti;
+xr[20] += tr;
+xi[20] += ti;
+tr = xr[23];
+ti = xi[23];
+xr[23] = xr[22] - tr;
+xi[23] = xi[22] - ti;
+xr[22] += tr;
+xi[22] += ti;
+tr = xr[25];
+ti = xi[25];
+xr[25] = xr[24] - tr;
+xi[25] = xi[24] - ti;
+xr[24] += tr;
+xi[24] += ti;
+tr = xr[27];
+ti = xi[27];
+xr[27] = xr[26] - tr;
+xi[27] = xi[26] - ti;
+xr[26] += tr;
+xi[26] += ti;
+tr = xr[29];
+ti = xi[29];
+xr[29] = xr[28] - tr;
+xi[29] = xi[28] - ti;
+xr[28] += tr;
+xi[28] += ti;
+tr = xr[31];
+ti = xi[31];
+xr[31] = xr[30] - tr;
+xi[31] = xi[30] - ti;
+xr[30] += tr;
+xi[30] += ti;
+tr = xr[2];
+ti = xi[2];
+xr[2] = xr[0] - tr;
+xi[2] = xi[0] - ti;
+xr[0] += tr;
+xi[0] += ti;
+tr = xr[6];
+ti = xi[6];
+xr[6] = xr[4] - tr;
+xi[6] = xi[4] - ti;
+xr[4] += tr;
+xi[4] += ti;
+tr = xr[10];
+ti = xi[10];
+xr[10] = xr[8] - tr;
+xi[10] = xi[8] - ti;
+xr[8] += tr;
+xi[8] += ti;
+tr = xr[14];
+ti = xi[14];
+xr[14] = xr[12] - tr;
+xi[14] = xi[12] - ti;
+xr[12] += tr;
+xi[12] += ti;
+tr = xr[18];
+ti = xi[18];
+xr[18] = xr[16] - tr;
+xi[18] = xi[16] - ti;
+xr[16] += tr;
+xi[16] += ti;
+tr = xr[22];
+ti = xi[22];
+xr[22] = xr[20] - tr;
+xi[22] = xi[20] - ti;
+xr[20] += tr;
+xi[20] += ti;
+tr = xr[26];
+ti = xi[26];
+xr[26] = xr[24] - tr;
+xi[26] = xi[24] - ti;
+xr[24] += tr;
+xi[24] += ti;
+tr = xr[30];
+ti = xi[30];
+xr[30] = xr[28] - tr;
+xi[30] = xi[28] - ti;
+xr[28] += tr;
+xi[28] += ti;
+tr = xi[3];
+ti = - xr[3];
+xr[3] = xr[1] - tr;
+xi[3] = xi[1] - ti;
+xr[1] += tr;
+xi[1] += ti;
+tr = xi[7];
+ti = - xr[7];
+xr[7] = xr[5] - tr;
+xi[7] = xi[5] - ti;
+xr[5] += tr;
+xi[5] += ti;
+tr = xi[11];
+ti = - xr[11];
+xr[11] = xr[9] - tr;
+xi[11] = xi[9] - ti;
+xr[9] += tr;
+xi[9] += ti;
+tr = xi[15];
+ti = - xr[15];
+xr[15] = xr[13] - tr;
+xi[15] = xi[13] - ti;
+xr[13] += tr;
+xi[13] += ti;
+tr = xi[19];
+ti = - xr[19];
+xr[19] = xr[17] - tr;
+xi[19] = xi[17] - ti;
+xr[17] += tr;
+xi[17] += ti;
+tr = xi[23];
+ti = - xr[23];
+xr[23] = xr[21] - tr;
+xi[23] = xi[21] - ti;
+xr[21] += tr;
+xi[21] += ti;
+tr = xi[27];
+ti = - xr[27];
+xr[27] = xr[25] - tr;
+xi[27] = xi[25] - ti;
+xr[25] += tr;
+xi[25] += ti;
+tr = xi[31];
+ti = - xr[31];
+xr[31] = xr[29] - tr;
+xi[31] = xi[29] - ti;
+xr[29] += tr;
+xi[29] += ti;
+tr = xr[4];
+ti = xi[4];
+xr[4] = xr[0] - tr;
+xi[4] = xi[0] - ti;
+xr[0] += tr;
+xi[0] += ti;
+tr = xr[12];
+ti = xi[12];
+xr[12] = xr[8] - tr;
+xi[12] = xi[8] - ti;
+xr[8] += tr;
+xi[8] += ti;
+tr = xr[20];
+ti = xi[20];
+xr[20] = xr[16] - tr;
+xi[20] = xi[16] - ti;
+xr[16] += tr;
+xi[16] += ti;
+tr = xr[28];
+ti = xi[28];
+xr[28] = xr[24] - tr;
+xi[28] = xi[24] - ti;
+xr[24] += tr;
+xi[24] += ti;
+tr =  7.07106781186548e-01*xr[5] +  7.07106781186547e-01*xi[5];
+ti =  7.07106781186548e-01*xi[5] -  7.07106781186547e-01*xr[5];
+xr[5] = xr[1] - tr;
+xi[5] = xi[1] - ti;
+xr[1] += tr;
+xi[1] += ti;
+tr =  7.07106781186548e-01*xr[13] +  7.07106781186547e-01*xi[13];
+ti =  7.07106781186548e-01*xi[13] -  7.07106781186547e-01*xr[13];
+xr[13] = xr[9] - tr;
+xi[13] = xi[9] - ti;
+xr[9] += tr;
+xi[9] += ti;
+tr =  7.07106781186548e-01*xr[21] +  7.07106781186547e-01*xi[21];
+ti =  7.07106781186548e-01*xi[21] -  7.07106781186547e-01*xr[21];
+xr[21] = xr[17] - tr;
+xi[21] = xi[17] - ti;
+xr[17] += tr;
+xi[17] += ti;
+tr =  7.07106781186548e-01*xr[29] +  7.07106781186547e-01*xi[29];
+ti =  7.07106781186548e-01*xi[29] -  7.07106781186547e-01*xr[29];
+xr[29] = xr[25] - tr;
+xi[29] = xi[25] - ti;
+xr[25] += tr;
+xi[25] += ti;
+tr = xi[6];
+ti = - xr[6];
+xr[6] = xr[2] - tr;
+xi[6] = xi[2] - ti;
+xr[2] += tr;
+xi[2] += ti;
+tr = xi[14];
+ti = - xr[14];
+xr[14] = xr[10] - tr;
+xi[14] = xi[10] - ti;
+xr[10] += tr;
+xi[10] += ti;
+tr = xi[22];
+ti = - xr[22];
+xr[22] = xr[18] - tr;
+xi[22] = xi[18] - ti;
+xr[18] += tr;
+xi[18] += ti;
+tr = xi[30];
+ti = - xr[30];
+xr[30] = xr[26] - tr;
+xi[30] = xi[26] - ti;
+xr[26] += tr;
+xi[26] += ti;
+tr = -7.07106781186547e-01*xr[7] +  7.07106781186548e-01*xi[7];
+ti = -7.07106781186547e-01*xi[7] -  7.07106781186548e-01*xr[7];
+xr[7] = xr[3] - tr;
+xi[7] = xi[3] - ti;
+xr[3] += tr;
+xi[3] += ti;
+tr = -7.07106781186547e-01*xr[15] +  7.07106781186548e-01*xi[15];
+ti = -7.07106781186547e-01*xi[15] -  7.07106781186548e-01*xr[15];
+xr[15] = xr[11] - tr;
+xi[15] = xi[11] - ti;
+xr[11] += tr;
+xi[11] += ti;
+tr = -7.07106781186547e-01*xr[23] +  7.07106781186548e-01*xi[23];
+ti = -7.07106781186547e-01*xi[23] -  7.07106781186548e-01*xr[23];
+xr[23] = xr[19] - tr;
+xi[23] = xi[19] - ti;
+xr[19] += tr;
+xi[19] += ti;
+tr = -7.07106781186547e-01*xr[31] +  7.07106781186548e-01*xi[31];
+ti = -7.07106781186547e-01*xi[31] -  7.07106781186548e-01*xr[31];
+xr[31] = xr[27] - tr;
+xi[31] = xi[27] - ti;
+xr[27] += tr;
+xi[27] += ti;
+tr = xr[8];
+ti = xi[8];
+xr[8] = xr[0] - tr;
+xi[8] = xi[0] - ti;
+xr[0] += tr;
+xi[0] += ti;
+tr = xr[24];
+ti = xi[24];
+xr[24] = xr[16] - tr;
+xi[24] = xi[16] - ti;
+xr[16] += tr;
+xi[16] += ti;
+tr =  9.23879532511287e-01*xr[9] +  3.82683432365090e-01*xi[9];
+ti =  9.23879532511287e-01*xi[9] -  3.82683432365090e-01*xr[9];
+xr[9] = xr[1] - tr;
+xi[9] = xi[1] - ti;
+xr[1] += tr;
+xi[1] += ti;
+tr =  9.23879532511287e-01*xr[25] +  3.82683432365090e-01*xi[25];
+ti =  9.23879532511287e-01*xi[25] -  3.82683432365090e-01*xr[25];
+xr[25] = xr[17] - tr;
+xi[25] = xi[17] - ti;
+xr[17] += tr;
+xi[17] += ti;
+tr =  7.07106781186548e-01*xr[10] +  7.07106781186547e-01*xi[10];
+ti =  7.07106781186548e-01*xi[10] -  7.07106781186547e-01*xr[10];
+xr[10] = xr[2] - tr;
+xi[10] = xi[2] - ti;
+xr[2] += tr;
+xi[2] += ti;
+tr =  7.07106781186548e-01*xr[26] +  7.07106781186547e-01*xi[26];
+ti =  7.07106781186548e-01*xi[26] -  7.07106781186547e-01*xr[26];
+xr[26] = xr[18] - tr;
+xi[26] = xi[18] - ti;
+xr[18] += tr;
+xi[18] += ti;
+tr =  3.82683432365090e-01*xr[11] +  9.23879532511287e-01*xi[11];
+ti =  3.82683432365090e-01*xi[11] -  9.23879532511287e-01*xr[11];
+xr[11] = xr[3] - tr;
+xi[11] = xi[3] - ti;
+xr[3] += tr;
+xi[3] += ti;
+tr =  3.82683432365090e-01*xr[27] +  9.23879532511287e-01*xi[27];
+ti =  3.82683432365090e-01*xi[27] -  9.23879532511287e-01*xr[27];
+xr[27] = xr[19] - tr;
+xi[27] = xi[19] - ti;
+xr[19] += tr;
+xi[19] += ti;
+tr = xi[12];
+ti = - xr[12];
+xr[12] = xr[4] - tr;
+xi[12] = xi[4] - ti;
+xr[4] += tr;
+xi[4] += ti;
+tr = xi[28];
+ti = - xr[28];
+xr[28] = xr[20] - tr;
+xi[28] = xi[20] - ti;
+xr[20] += tr;
+xi[20] += ti;
+tr = -3.82683432365090e-01*xr[13] +  9.23879532511287e-01*xi[13];
+ti = -3.82683432365090e-01*xi[13] -  9.23879532511287e-01*xr[13];
+xr[13] = xr[5] - tr;
+xi[13] = xi[5] - ti;
+xr[5] += tr;
+xi[5] += ti;
+tr = -3.82683432365090e-01*xr[29] +  9.23879532511287e-01*xi[29];
+ti = -3.82683432365090e-01*xi[29] -  9.23879532511287e-01*xr[29];
+xr[29] = xr[21] - tr;
+xi[29] = xi[21] - ti;
+xr[21] += tr;
+xi[21] += ti;
+tr = -7.07106781186547e-01*xr[14] +  7.07106781186548e-01*xi[14];
+ti = -7.07106781186547e-01*xi[14] -  7.07106781186548e-01*xr[14];
+xr[14] = xr[6] - tr;
+xi[14] = xi[6] - ti;
+xr[6] += tr;
+xi[6] += ti;
+tr = -7.07106781186547e-01*xr[30] +  7.07106781186548e-01*xi[30];
+ti = -7.07106781186547e-01*xi[30] -  7.07106781186548e-01*xr[30];
+xr[30] = xr[22] - tr;
+xi[30] = xi[22] - ti;
+xr[22] += tr;
+xi[22] += ti;
+tr = -9.23879532511287e-01*xr[15] +  3.82683432365090e-01*xi[15];
+ti = -9.23879532511287e-01*xi[15] -  3.82683432365090e-01*xr[15];
+xr[15] = xr[7] - tr;
+xi[15] = xi[7] - ti;
+xr[7] += tr;
+xi[7] += ti;
+tr = -9.23879532511287e-01*xr[31] +  3.82683432365090e-01*xi[31];
+ti = -9.23879532511287e-01*xi[31] -  3.82683432365090e-01*xr[31];
+xr[31] = xr[23] - tr;
+xi[31] = xi[23] - ti;
+xr[23] += tr;
+xi[23] += ti;
+tr = xr[16];
+ti = xi[16];
+xr[16] = xr[0] - tr;
+xi[16] = xi[0] - ti;
+xr[0] += tr;
+xi[0] += ti;
+tr =  9.80785280403230e-01*xr[17] +  1.95090322016128e-01*xi[17];
+ti =  9.80785280403230e-01*xi[17] -  1.95090322016128e-01*xr[17];
+xr[17] = xr[1] - tr;
+xi[17] = xi[1] - ti;
+xr[1] += tr;
+xi[1] += ti;
+tr =  9.23879532511287e-01*xr[18] +  3.82683432365090e-01*xi[18];
+ti =  9.23879532511287e-01*xi[18] -  3.82683432365090e-01*xr[18];
+xr[18] = xr[2] - tr;
+xi[18] = xi[2] - ti;
+xr[2] += tr;
+xi[2] += ti;
+tr =  8.31469612302545e-01*xr[19] +  5.55570233019602e-01*xi[19];
+ti =  8.31469612302545e-01*xi[19] -  5.55570233019602e-01*xr[19];
+xr[19] = xr[3] - tr;
+xi[19] = xi[3] - ti;
+xr[3] += tr;
+xi[3] += ti;
+tr =  7.07106781186548e-01*xr[20] +  7.07106781186547e-01*xi[20];
+ti =  7.07106781186548e-01*xi[20] -  7.07106781186547e-01*xr[20];
+xr[20] = xr[4] - tr;
+xi[20] = xi[4] - ti;
+xr[4] += tr;
+xi[4] += ti;
+tr =  5.55570233019602e-01*xr[21] +  8.31469612302545e-01*xi[21];
+ti =  5.55570233019602e-01*xi[21] -  8.31469612302545e-01*xr[21];
+xr[21] = xr[5] - tr;
+xi[21] = xi[5] - ti;
+xr[5] += tr;
+xi[5] += ti;
+tr =  3.82683432365090e-01*xr[22] +  9.23879532511287e-01*xi[22];
+ti =  3.82683432365090e-01*xi[22] -  9.23879532511287e-01*xr[22];
+xr[22] = xr[6] - tr;
+xi[22] = xi[6] - ti;
+xr[6] += tr;
+xi[6] += ti;
+tr =  1.95090322016128e-01*xr[23] +  9.80785280403230e-01*xi[23];
+ti =  1.95090322016128e-01*xi[23] -  9.80785280403230e-01*xr[23];
+xr[23] = xr[7] - tr;
+xi[23] = xi[7] - ti;
+xr[7] += tr;
+xi[7] += ti;
+tr = xi[24];
+ti = - xr[24];
+xr[24] = xr[8] - tr;
+xi[24] = xi[8] - ti;
+xr[8] += tr;
+xi[8] += ti;
+tr = -1.95090322016128e-01*xr[25] +  9.80785280403230e-01*xi[25];
+ti = -1.95090322016128e-01*xi[25] -  9.80785280403230e-01*xr[25];
+xr[25] = xr[9] - tr;
+xi[25] = xi[9] - ti;
+xr[9] += tr;
+xi[9] += ti;
+tr = -3.82683432365090e-01*xr[26] +  9.23879532511287e-01*xi[26];
+ti = -3.82683432365090e-01*xi[26] -  9.23879532511287e-01*xr[26];
+xr[26] = xr[10] - tr;
+xi[26] = xi[10] - ti;
+xr[10] += tr;
+xi[10] += ti;
+tr = -5.55570233019602e-01*xr[27] +  8.31469612302545e-01*xi[27];
+ti = -5.55570233019602e-01*xi[27] -  8.31469612302545e-01*xr[27];
+xr[27] = xr[11] - tr;
+xi[27] = xi[11] - ti;
+xr[11] += tr;
+xi[11] += ti;
+tr = -7.07106781186547e-01*xr[28] +  7.07106781186548e-01*xi[28];
+ti = -7.07106781186547e-01*xi[28] -  7.07106781186548e-01*xr[28];
+xr[28] = xr[12] - tr;
+xi[28] = xi[12] - ti;
+xr[12] += tr;
+xi[12] += ti;
+tr = -8.31469612302545e-01*xr[29] +  5.55570233019602e-01*xi[29];
+ti = -8.31469612302545e-01*xi[29] -  5.55570233019602e-01*xr[29];
+xr[29] = xr[13] - tr;
+xi[29] = xi[13] - ti;
+xr[13] += tr;
+xi[13] += ti;
+tr = -9.23879532511287e-01*xr[30] +  3.82683432365090e-01*xi[30];
+ti = -9.23879532511287e-01*xi[30] -  3.82683432365090e-01*xr[30];
+xr[30] = xr[14] - tr;
+xi[30] = xi[14] - ti;
+xr[14] += tr;
+xi[14] += ti;
+tr = -9.80785280403230e-01*xr[31] +  1.95090322016129e-01*xi[31];
+ti = -9.80785280403230e-01*xi[31] -  1.95090322016129e-01*xr[31];
+xr[31] = xr[15] - tr;
+xi[31] = xi[15] - ti;
+xr[15] += tr;
+xi[15] += ti;
@@ -0,0 +1,92 @@
+//##############################################################################
+// File: fftBench.c
+//
+// Program to measure the speed of an FFT generated by fftGen
+//
+// The FFT must be generated as complete function fft() by option -e fft and be
+// linked to this program. The number of points N and the type of the array
+// elements FFT_TYPE are defined on the compiler command line ("-D..."). The
+// program calls fft() repeatedly and prints the mean time of one call. The
+// number of calls can be given as argument, see makebench.sh.
+//
+// Version 1     2026 Oct 16th
+//
+//------------------------------------------------------------------------------
+// Copyright (C) 2026  Jost Brachert, jost.brachert@gmx.de
+//
+// This program is free software: you can redistribute it and/or modify it under
+// the terms of the GNU General Public License as published by the Free Software
+// Foundation; either version 3 of the license, or (at your option) any later
+// version.
+//
+// This program is distributed in the hope that it will be useful, but WITHOUT
+// ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+// FOR A PARTICULAR PURPOSE. See the GNU General Public License for more
+// details.
+//
+// You should have received a copy of the GNU General Public License along with
+// this program, see file COPYING. If not, see https://www.gnu.org/licenses/.
+//
+
+#include  <stdio.h>
+#include <stdlib.h>     // rand(),RAND_MAX,atoi()
+#include <string.h>     // memcpy()
+#include   <time.h>     // clock(),CLOCKS_PER_SEC
+
+#define  LOGO   "fftBench"
+
+// Commented out defines come from compiler command line
+
+//#define  N   1024
+#ifndef FFT_TYPE
+#define  FFT_TYPE       double
+#endif
+#ifndef REPEAT
+#define  REPEAT  10000              // Default number of calls of fft()
+#endif
+
+void  fft (FFT_TYPE *xr, FFT_TYPE *xi);     // Generated by fftGen -e fft
+
+
+
+//==============================================================================
+// main
+//
+
+int  main (
+    const int    argc,
+    const char  *argv[]
+) {
+    static FFT_TYPE  xr0[N], xi0[N];        // Input signal
+    static FFT_TYPE  xr[N], xi[N];
+    const int  repeat = argc > 1 ? atoi (argv[1]) : REPEAT;
+    double  sum = 0.;
+    clock_t  t;
+    int  i, r;
+
+    if (repeat < 1) {
+        fprintf (stderr, LOGO": Invalid number of calls %s\n", argv[1]);
+        return  EXIT_FAILURE;
+    }
+
+    for (i=0; i<N; ++i) {
+        xr0[i] = (FFT_TYPE)rand() / RAND_MAX - 0.5;
+        xi0[i] = (FFT_TYPE)rand() / RAND_MAX - 0.5;
+    }
+
+    // The input is restored before each call, so the values stay in the same
+    // range. Copying is negligible compared to the FFT.
+    t = clock ();
+    for (r=0; r<repeat; ++r) {
+        memcpy (xr, xr0, sizeof(xr));
+        memcpy (xi, xi0, sizeof(xi));
+        fft (xr, xi);
+        sum += xr[r%N];             // Keep the compiler from dropping calls
+    }
+    t = clock () - t;
+
+    printf (LOGO": %d calls, %.3f us per call (checksum %g)\n", repeat,
+            1.e6*t/CLOCKS_PER_SEC/repeat, sum);
+
+    return  EXIT_SUCCESS;
+}
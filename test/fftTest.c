@@ -34,14 +34,58 @@
 // Commented out defines come from compiler command line
 
 //#define  M   5
+//#define  N   480     // If not power of 2, M selects the test signal only
+#ifndef N
 #define  N  (1<<M)
+#endif
 
 //#define  REAL_IN_OPTIMIZED
 //#define  REAL_OUT_OPTIMIZED
 //#define  SYMM_IN_OPTIMIZED
 //#define  SYMM_OUT_OPTIMIZED
 //#define  TEST_OUTPUT
+//#define  BIT_REVERSED_ORDER
+//#define  OUT_OF_PLACE
+//#define  REAL_FFT
+//#define  REAL_IFFT
+//#define  DCT              // Test a DCT-II and the inverse DCT-III on x[]
+//#define  MDCT             // Test an MDCT and an IMDCT on x[] against direct
+//#define  SINE_WINDOW      //   sums, optionally with the sine window
+//#define  COLS         16  // Test a two-dimensional FFT of N/COLS rows and COLS
+                            //   columns stored row by row
+//#define  ROWS          8  // With COLS test a three-dimensional FFT of
+                            //   N/(ROWS*COLS) planes of ROWS rows
+//#define  BATCH         4  // Test BATCH interleaved signals, signal b being the
+                            //   test signal scaled by b+1
+//#define  FUNCTION         // fft.c and ffti.c are complete functions fft() and
+                            //   ffti()
+//#define  INTERLEAVED      // The tested code works on the complex values
+                            //   interleaved in x[], x[2k]=xr[k], x[2k+1]=xi[k]
+//#define  STRIDE        3  // With FUNCTION the tested functions work on every
+                            //   STRIDE-th element, the others must not change
+//#define  IN_STRIDE     2  // With OUT_OF_PLACE the stride of the input,
+                            //   default STRIDE
+//#define  STRIDE_ARGS  ,3  // Arguments of the strides passed to the functions
 //#define  NON_ZERO_IMAG_INPUT
+//#define  ARRAY_SIZE   64  // Size of xr[] and xi[] if greater than N
+//#define  CHIRP_Z          // Test BINS bins from START_BIN with BIN_SPACING
+//#define  BINS         20  //   against a direct sum, skip the inverse test
+//#define  START_BIN    2.5
+//#define  BIN_SPACING  0.1
+#ifndef ARRAY_SIZE
+#ifdef BATCH
+#define  ARRAY_SIZE  (N*BATCH)
+#else
+#define  ARRAY_SIZE  N
+#endif
+#endif
+#ifdef CHIRP_Z
+#define  NOUT  BINS                 // Number of output values
+#elif defined MDCT
+#define  NOUT  (N/2)
+#else
+#define  NOUT  N
+#endif
 #ifndef FFT_TYPE
 #define  FFT_TYPE       double
 #endif
@@ -50,19 +94,221 @@
 #define  EPS   1.e-8                // Tolerance for comparison to reference
 #endif
 
+#ifndef FFT_TEMPS
+#define  FFT_TEMPS   tr, ti         // Temporaries required by the tested code
+#endif
+
+#ifdef OUT_OF_PLACE
+// The tested code reads the input from xr_in[] and xi_in[] and writes the
+// result to xr[] and xi[], using yr[] and yi[] as work arrays. The output
+// arrays are filled with a huge value, so reading them before writing fails
+// the test.
+#define  OUT_OF_PLACE_INPUT                                                 \
+    FFT_TYPE  inr[ARRAY_SIZE], ini[ARRAY_SIZE], yr[N], yi[N];             \
+    const FFT_TYPE  *const xr_in = inr;                                   \
+    const FFT_TYPE  *const xi_in = ini;                                   \
+    int  k;                                                                 \
+    for (k=0; k<ARRAY_SIZE; ++k) {                                          \
+        inr[k] = xr[k];                                                     \
+        ini[k] = xi[k];                                                     \
+        xr[k] = xi[k] = 1.e30;                                              \
+    }                                                                       \
+    (void)xr_in; (void)xi_in; (void)yr; (void)yi;   // Maybe unused
+#endif
+
+#ifdef INTERLEAVED
+// The tested code works on the complex values interleaved in the one array x[]
+#define  INTERLEAVED_INPUT                                                  \
+    FFT_TYPE  x[2*ARRAY_SIZE];                                              \
+    int  k;                                                                 \
+    for (k=0; k<ARRAY_SIZE; ++k) {                                          \
+        x[2*k]   = xr[k];                                                   \
+        x[2*k+1] = xi[k];                                                   \
+    }
+#define  INTERLEAVED_OUTPUT                                                 \
+    for (k=0; k<ARRAY_SIZE; ++k) {                                          \
+        xr[k] = x[2*k];                                                     \
+        xi[k] = x[2*k+1];                                                   \
+    }
+#endif
+
+#ifdef STRIDE
+// The tested function works on every STRIDE-th element of sr[] and si[],
+// reading with OUT_OF_PLACE every IN_STRIDE-th element of ir[] and ii[]. The
+// elements in between are filled with a huge value and must not change.
+#ifndef IN_STRIDE
+#define  IN_STRIDE  STRIDE
+#endif
+#ifndef STRIDE_ARGS
+#define  STRIDE_ARGS
+#endif
+#ifdef OUT_OF_PLACE
+#define  STRIDE_CALL(f)  f (ir, ii, sr, si STRIDE_ARGS)
+#else
+#define  STRIDE_CALL(f)  f (sr, si STRIDE_ARGS)
+#endif
+#define  STRIDE_TEST(f)                                                     \
+    static FFT_TYPE  ir[N*IN_STRIDE], ii[N*IN_STRIDE];                    \
+    static FFT_TYPE  sr[N*STRIDE], si[N*STRIDE];                          \
+    int  k;                                                                 \
+    for (k=0; k<N*IN_STRIDE; ++k)  ir[k] = ii[k] = 1.e30;                   \
+    for (k=0; k<N*STRIDE; ++k)  sr[k] = si[k] = 1.e30;                      \
+    for (k=0; k<N; ++k) {                                                   \
+        ir[k*IN_STRIDE] = sr[k*STRIDE] = xr[k];                             \
+        ii[k*IN_STRIDE] = si[k*STRIDE] = xi[k];                             \
+    }                                                                       \
+    STRIDE_CALL(f);                                                         \
+    (void)ir; (void)ii;                             /* Maybe unused */      \
+    for (k=0; k<N*STRIDE; ++k) {                                            \
+        if (k%STRIDE == 0) {                                                \
+            xr[k/STRIDE] = sr[k];                                           \
+            xi[k/STRIDE] = si[k];                                           \
+        } else if (sr[k] != 1.e30  ||  si[k] != 1.e30) {                    \
+            fprintf (stderr, LOGO": at idx %d element between the strides"  \
+                     " changed\n", k);                                      \
+            strideFailed = 1;                                               \
+        }                                                                   \
+    }
+#endif
+
+#ifdef REAL_FFT
+// The tested code transforms the real values in x[] and stores the result in
+// the packed format x[0]=X[0], x[1]=X[N/2], x[2k]+i*x[2k+1]=X[k]
+#define  REAL_FFT_INPUT                                                     \
+    FFT_TYPE  x[N];                                                         \
+    int  k;                                                                 \
+    for (k=0; k<N; ++k)  x[k] = xr[k];
+#define  REAL_FFT_OUTPUT                                                    \
+    xr[0] = x[0];                                                           \
+    xi[0] = 0.;                                                             \
+    if (N > 1) {                                                            \
+        xr[N/2] = x[N>1];                                                   \
+        xi[N/2] = 0.;                                                       \
+    }                                                                       \
+    for (k=1; k<N/2; ++k) {                                                 \
+        xr[k] = xr[N-k] =  x[2*k];                                          \
+        xi[k]           =  x[2*k+1];                                        \
+        xi[N-k]         = -x[2*k+1];                                        \
+    }
+#endif
+
+#ifdef REAL_IFFT
+// The tested code takes X[0]...X[N/2] in the packed format of REAL_FFT from x[]
+// and writes the N real values of the inverse transform to x[]
+#define  REAL_IFFT_INPUT                                                    \
+    FFT_TYPE  x[N];                                                         \
+    int  k;                                                                 \
+    x[0] = xr[0];                                                           \
+    if (N > 1)  x[N>1] = xr[N/2];                                           \
+    for (k=1; k<N/2; ++k) {                                                 \
+        x[2*k]   = xr[k];                                                   \
+        x[2*k+1] = xi[k];                                                   \
+    }
+#define  REAL_IFFT_OUTPUT                                                   \
+    for (k=0; k<N; ++k) {                                                   \
+        xr[k] = x[k];                                                       \
+        xi[k] = 0.;                                                         \
+    }
+#endif
+
+#ifdef DCT
+// The tested code transforms the real values in x[] by a DCT-II and back by a
+// DCT-III, which yields the input scaled by N/2
+#define  DCT_INPUT                                                          \
+    FFT_TYPE  x[N];                                                         \
+    int  k;                                                                 \
+    for (k=0; k<N; ++k)  x[k] = xr[k];
+#define  DCT_OUTPUT                                                         \
+    for (k=0; k<N; ++k) {                                                   \
+        xr[k] = x[k];                                                       \
+        xi[k] = 0.;                                                         \
+    }
+#define  DCT_IFFT_OUTPUT                                                    \
+    for (k=0; k<N; ++k) {                                                   \
+        xr[k] = 2.*x[k];                                                    \
+        xi[k] = 0.;                                                         \
+    }
+#endif
+
+#ifdef MDCT
+// The tested code transforms the N real values in x[] by an MDCT to N/2 values
+// stored in x[0]...x[N/2-1], and these back by an IMDCT to N values. The
+// IMDCT result is compared to a direct sum, not to the input sequence.
+#define  MDCT_INPUT                                                         \
+    FFT_TYPE  x[N];                                                         \
+    int  k;                                                                 \
+    for (k=0; k<N; ++k)  x[k] = xr[k];
+#define  MDCT_OUTPUT                                                        \
+    for (k=0; k<N; ++k) {                                                   \
+        xr[k] = k < N/2 ? x[k] : 0.;                                        \
+        xi[k] = 0.;                                                         \
+    }
+#define  IMDCT_INPUT                                                        \
+    FFT_TYPE  x[N];                                                         \
+    int  k;                                                                 \
+    for (k=0; k<N; ++k)  x[k] = k < N/2 ? xr[k] : rand();
+#define  IMDCT_OUTPUT                                                       \
+    for (k=0; k<N; ++k) {                                                   \
+        xr[k] = N*x[k];             /* Compensate the scaling by the test */\
+        xi[k] = 0.;                                                         \
+    }
+#endif
+
+#ifdef BATCH
+// The test signal in xr[0...N-1] and xi[0...N-1] is spread in place to BATCH
+// interleaved signals, signal b scaled by b+1. After the transform all
+// signals are compared to signal 0, which is then moved back to the start.
+#define  BATCH_INPUT                                                        \
+    {                                                                       \
+        int  k, b;                                                          \
+        for (k=N-1; k>=0; --k) {                                            \
+            for (b=BATCH-1; b>=0; --b) {                                    \
+                xr[k*BATCH+b] = (b+1)*xr[k];                                \
+                xi[k*BATCH+b] = (b+1)*xi[k];                                \
+            }                                                               \
+        }                                                                   \
+    }
+#define  BATCH_OUTPUT(nOut,imag)                                            \
+    {                                                                       \
+        int  k, b;                                                          \
+        for (k=0; k<(nOut); ++k) {                                          \
+            for (b=1; b<BATCH; ++b) {                                       \
+                FFT_TYPE  dr = xr[k*BATCH+b]/(b+1) - xr[k*BATCH];           \
+                FFT_TYPE  di = xi[k*BATCH+b]/(b+1) - xi[k*BATCH];           \
+                if (fabs(dr) > EPS  ||  ((imag)  &&  fabs(di) > EPS)) {     \
+                    fprintf (stderr, LOGO": at idx %d signal %d differs\n", \
+                             k, b);                                         \
+                    batchFailed = 1;                                        \
+                }                                                           \
+            }                                                               \
+        }                                                                   \
+        for (k=0; k<N; ++k) {                                               \
+            xr[k] = xr[k*BATCH];                                            \
+            xi[k] = xi[k*BATCH];                                            \
+        }                                                                   \
+    }
+#endif
+
 typedef  struct Complex {double  r;
                          double  i;}  COMPLEX;
 
-FFT_TYPE  xr[N];
-FFT_TYPE  xi[N];
-COMPLEX  xRef[N];
+FFT_TYPE  xr[ARRAY_SIZE];
+FFT_TYPE  xi[ARRAY_SIZE];
+COMPLEX  xRef[ARRAY_SIZE];
 COMPLEX  xOri[N];
+int      batchFailed;               // Flag: !=0: Test of the BATCH signals failed
+int      strideFailed;              // Flag: !=0: Test of the STRIDE gaps failed
 
 
 void  fftRef (COMPLEX*, int);
+void  chirpRef (const COMPLEX*, COMPLEX*);
+void  dctRef (const COMPLEX*, COMPLEX*);
+void  mdctRef (const COMPLEX*, COMPLEX*, int);
+void  fftNdRef (COMPLEX*);
 void  fft (FFT_TYPE*,FFT_TYPE*);
 void  ffti (FFT_TYPE*,FFT_TYPE*);
 void  conv (COMPLEX, double*, double*);
+void  bitRevPermute (FFT_TYPE*,FFT_TYPE*);
 
 
 
@@ -123,7 +369,17 @@ int  main ()
         xOri[i].i = xRef[i].i = xi[i];
     }
 
+#if defined CHIRP_Z
+    chirpRef (xOri,xRef);
+#elif defined DCT
+    dctRef (xOri,xRef);
+#elif defined MDCT
+    mdctRef (xOri,xRef,0);
+#elif defined COLS
+    fftNdRef (xRef);
+#else
     fftRef (xRef,N);
+#endif
 
     //==========================================================================
     fputs (LOGO": Standard FFT Test\n", stderr);
@@ -136,6 +392,10 @@ int  main ()
 
     fft (xr,xi);
 
+#ifdef BIT_REVERSED_ORDER
+    bitRevPermute (xr,xi);              // Result is in bit reversed order
+#endif
+
 #ifdef SYMM_OUT_OPTIMIZED
     for (i=N/2+1; i<N; ++i) {           // Reconstruct the omitted values
         xr[i] =  xr[N-i];               //   for the IFFT later
@@ -145,7 +405,7 @@ int  main ()
 
     //--------------------------------------------------------------------------
     // Compare result
-    for (i=0; i<N; ++i) {
+    for (i=0; i<NOUT; ++i) {
         if (fabs(xr[i]-xRef[i].r) > EPS) {
             fprintf (stderr,
                      LOGO": at idx %d real: res: %13.6e <> ref: %13.6e\n",
@@ -178,6 +438,7 @@ int  main ()
     putchar ('\n');
 #endif
 
+#ifndef CHIRP_Z
     //==========================================================================
     fputs (LOGO": Inverse FFT Test\n", stderr);
 
@@ -188,6 +449,14 @@ int  main ()
     }
 #endif
 
+#ifdef BIT_REVERSED_ORDER
+    bitRevPermute (xr,xi);              // Input expected in bit reversed order
+#endif
+
+#ifdef MDCT
+    mdctRef (xRef,xOri,1);              // The IMDCT doesn't yield the input
+#endif
+
     ffti (xr,xi);
 
     for (i=0; i<N; ++i) {
@@ -228,8 +497,9 @@ int  main ()
                   i/(ts*N), xr[i], xi[i], r*(N/2), phi, xOri[i].r, xOri[i].i);
     }
 #endif
+#endif  // CHIRP_Z
 
-    if (failed)  return 1;
+    if (failed || batchFailed || strideFailed)  return 1;
     return 0;
 }
 
@@ -249,6 +519,20 @@ void  fftRef (
     int     nm,mr,nn,m,k,istep,i,ii,jj;
     double  tr,ti,a,wr,wi;
 
+    if (n & (n-1)) {                    // Not a power of 2: use plain DFT
+        static COMPLEX  y[N];
+        for (k=0; k<n; ++k) {
+            y[k].r = y[k].i = 0.;
+            for (m=0; m<n; ++m) {
+                a  = 2.*M_PI*(-(double)((long)m*k%n))/n;
+                y[k].r += cos(a)*x[m].r - sin(a)*x[m].i;
+                y[k].i += cos(a)*x[m].i + sin(a)*x[m].r;
+            }
+        }
+        for (k=0; k<n; ++k)  x[k] = y[k];
+        return;
+    }
+
     mr = 0;
     nn = n-1;
 
@@ -284,6 +568,202 @@ void  fftRef (
 
 
 
+//==============================================================================
+// Reference chirp z-transform, computed by the direct sum
+//
+
+void  chirpRef (
+    const COMPLEX  x[],
+    COMPLEX        y[]
+) {
+#ifdef CHIRP_Z
+    int     k, j;
+    double  a;
+
+    for (k=0; k<BINS; ++k) {
+        y[k].r = y[k].i = 0.;
+        for (j=0; j<N; ++j) {
+            a  = -2.*M_PI*j*(START_BIN + k*BIN_SPACING)/N;
+            y[k].r += cos(a)*x[j].r - sin(a)*x[j].i;
+            y[k].i += cos(a)*x[j].i + sin(a)*x[j].r;
+        }
+    }
+#else
+    (void)x; (void)y;
+#endif
+}
+
+
+
+//==============================================================================
+// Reference DCT-II, computed by the direct sum
+//
+
+void  dctRef (
+    const COMPLEX  x[],
+    COMPLEX        y[]
+) {
+    int  k, j;
+
+    for (k=0; k<N; ++k) {
+        y[k].r = y[k].i = 0.;
+        for (j=0; j<N; ++j) {
+            y[k].r += x[j].r * cos (M_PI*(2*j+1)*k/(2.*N));
+        }
+    }
+}
+
+
+
+//==============================================================================
+// Reference MDCT and IMDCT, computed by the direct sums
+//
+
+void  mdctRef (
+    const COMPLEX  x[],
+    COMPLEX        y[],
+    int            inv
+) {
+    int  k, j;
+
+    for (j=0; j<N; ++j) {
+        y[j].r = y[j].i = 0.;
+    }
+    for (k=0; k<N/2; ++k) {
+        for (j=0; j<N; ++j) {
+            const double  c = cos (2.*M_PI/N*(j+0.5+N/4)*(k+0.5));
+#ifdef SINE_WINDOW
+            const double  w = sin (M_PI*(j+0.5)/N);
+#else
+            const double  w = 1.;
+#endif
+            if (inv)  y[j].r += w * x[k].r * c;
+            else      y[k].r += w * x[j].r * c;
+        }
+    }
+}
+
+
+
+//==============================================================================
+// Reference two- or three-dimensional FFT, computed by the FFTs along each
+// dimension
+//
+
+void  fftNdRef (
+    COMPLEX  x[]
+) {
+#ifdef COLS
+#ifdef ROWS
+    static const int  dim[] = {N/(ROWS*COLS), ROWS, COLS};
+#else
+    static const int  dim[] = {N/COLS, COLS};
+#endif
+    static COMPLEX  y[N];
+    int  d, s, i, k;
+
+    for (d=sizeof(dim)/sizeof(dim[0])-1, s=1; d>=0; s*=dim[d--]) {
+        for (i=0; i<N; ++i) {
+            if (i/s % dim[d])  continue;    // Not the first element along d
+            for (k=0; k<dim[d]; ++k)  y[k] = x[i+k*s];
+            fftRef (y, dim[d]);
+            for (k=0; k<dim[d]; ++k)  x[i+k*s] = y[k];
+        }
+    }
+#else
+    (void)x;
+#endif
+}
+
+
+
+#ifdef FUNCTION
+//==============================================================================
+// FFT and IFFT Test Objects generated as complete functions
+//
+
+#ifdef INTERLEAVED
+#define  fft    fftInterleaved
+#define  ffti   fftiInterleaved
+#endif
+#ifdef STRIDE
+#define  fft    fftStrided
+#define  ffti   fftiStrided
+#elif defined OUT_OF_PLACE
+#define  fft    fftOutOfPlace
+#define  ffti   fftiOutOfPlace
+#endif
+#include "fft.c"
+#include "ffti.c"
+#ifdef STRIDE
+#undef  fft
+#undef  ffti
+
+// The generated functions take the arrays of strided elements and maybe the
+// strides
+
+void  fft (
+    FFT_TYPE  *xr,
+    FFT_TYPE  *xi
+) {
+    STRIDE_TEST(fftStrided)
+}
+
+void  ffti (
+    FFT_TYPE  *xr,
+    FFT_TYPE  *xi
+) {
+    STRIDE_TEST(fftiStrided)
+}
+#elif defined OUT_OF_PLACE
+#undef  fft
+#undef  ffti
+
+// The generated functions take the const input arrays before the output arrays
+
+void  fft (
+    FFT_TYPE  *xr,
+    FFT_TYPE  *xi
+) {
+    OUT_OF_PLACE_INPUT
+    fftOutOfPlace (xr_in, xi_in, xr, xi);
+}
+
+void  ffti (
+    FFT_TYPE  *xr,
+    FFT_TYPE  *xi
+) {
+    OUT_OF_PLACE_INPUT
+    fftiOutOfPlace (xr_in, xi_in, xr, xi);
+}
+#endif
+#ifdef INTERLEAVED
+#undef  fft
+#undef  ffti
+
+// The generated functions take x[], or with layout c99complex the C99 complex
+// array xc[] of the same layout
+
+void  fft (
+    FFT_TYPE  *xr,
+    FFT_TYPE  *xi
+) {
+    INTERLEAVED_INPUT
+    fftInterleaved ((void*)x);
+    INTERLEAVED_OUTPUT
+}
+
+void  ffti (
+    FFT_TYPE  *xr,
+    FFT_TYPE  *xi
+) {
+    INTERLEAVED_INPUT
+    fftiInterleaved ((void*)x);
+    INTERLEAVED_OUTPUT
+}
+#endif
+
+#else
 //==============================================================================
 // FFT Test Object
 //
@@ -292,8 +772,45 @@ void  fft (
     FFT_TYPE  *xr,
     FFT_TYPE  *xi
 ) {
-    FFT_TYPE  tr, ti;
+    FFT_TYPE  FFT_TEMPS;
+#ifdef REAL_FFT
+    REAL_FFT_INPUT
+#endif
+#ifdef DCT
+    DCT_INPUT
+#endif
+#ifdef MDCT
+    MDCT_INPUT
+#endif
+#ifdef BATCH
+    BATCH_INPUT
+#endif
+#ifdef OUT_OF_PLACE
+    OUT_OF_PLACE_INPUT
+#endif
+#ifdef INTERLEAVED
+    INTERLEAVED_INPUT
+#endif
 #include "fft.c"
+#ifdef INTERLEAVED
+    INTERLEAVED_OUTPUT
+#endif
+#ifdef BATCH
+#ifdef SYMM_OUT_OPTIMIZED
+    BATCH_OUTPUT(N/2+1,1)
+#else
+    BATCH_OUTPUT(N,1)
+#endif
+#endif
+#ifdef REAL_FFT
+    REAL_FFT_OUTPUT
+#endif
+#ifdef DCT
+    DCT_OUTPUT
+#endif
+#ifdef MDCT
+    MDCT_OUTPUT
+#endif
 }
 
 
@@ -306,9 +823,47 @@ void  ffti (
     FFT_TYPE  *xr,
     FFT_TYPE  *xi
 ) {
-    FFT_TYPE  tr, ti;
+    FFT_TYPE  FFT_TEMPS;
+#ifdef REAL_IFFT
+    REAL_IFFT_INPUT
+#endif
+#ifdef DCT
+    DCT_INPUT
+#endif
+#ifdef MDCT
+    IMDCT_INPUT
+#endif
+#ifdef BATCH
+    BATCH_INPUT
+#endif
+#ifdef OUT_OF_PLACE
+    OUT_OF_PLACE_INPUT
+#endif
+#ifdef INTERLEAVED
+    INTERLEAVED_INPUT
+#endif
 #include "ffti.c"
+#ifdef INTERLEAVED
+    INTERLEAVED_OUTPUT
+#endif
+#ifdef BATCH
+#ifdef REAL_OUT_OPTIMIZED
+    BATCH_OUTPUT(N,0)
+#else
+    BATCH_OUTPUT(N,1)
+#endif
+#endif
+#ifdef REAL_IFFT
+    REAL_IFFT_OUTPUT
+#endif
+#ifdef DCT
+    DCT_IFFT_OUTPUT
+#endif
+#ifdef MDCT
+    IMDCT_OUTPUT
+#endif
 }
+#endif  // FUNCTION
 
 
 
@@ -337,3 +892,27 @@ void  conv (
         }
     }
 }
+
+
+
+//==============================================================================
+// Bit reversal permutation of the sequence (its own inverse)
+//
+
+void  bitRevPermute (
+    FFT_TYPE  *xr,
+    FFT_TYPE  *xi
+) {
+    int  m, mr, k;
+
+    for (m=0; m<N; ++m) {
+        for (mr=0,k=1; k<N; k*=2) {
+            mr = 2*mr + ((m/k) & 1);
+        }
+        if (mr > m) {
+            FFT_TYPE  t;
+            t = xr[m];  xr[m] = xr[mr];  xr[mr] = t;
+            t = xi[m];  xi[m] = xi[mr];  xi[mr] = t;
+        }
+    }
+}